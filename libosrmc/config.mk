@@ -76,7 +76,9 @@ CXX_NO_RTTI = -fno-rtti
 CXXFLAGS_BASE = $(CXX_OPTIMIZATION_LEVEL) $(CXX_WARNING_FLAGS) $(CXX_STANDARD) $(CXX_VISIBILITY_FLAG) $(CXX_POSITION_INDEPENDENT) $(CXX_NO_RTTI)
 
 # Skip pkg-config checks for targets that don't need OSRM (allows clean/show-config without deps)
-SKIP_DEPS := $(filter clean show-config,$(MAKECMDGOALS))
+# Driver targets (lto, pgo-*) only recurse into make; the recursive
+# invocation performs the real dependency check
+SKIP_DEPS := $(filter clean clean-profiles show-config lto pgo-generate pgo-use,$(MAKECMDGOALS))
 ifeq ($(SKIP_DEPS),)
     PKG_CONFIG := $(shell which pkg-config 2>/dev/null)
     ifeq ($(PKG_CONFIG),)
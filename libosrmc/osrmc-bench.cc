@@ -0,0 +1,401 @@
+/*
+ * osrmc-bench: multithreaded benchmark harness for the libosrmc wrapper layer.
+ *
+ * Exercises all six services through the public C API against a given dataset
+ * and reports per-service throughput, latency percentiles (p50/p95/p99/p99.9)
+ * and approximate heap traffic per request. Intended to run in CI against a
+ * fixed extract so wrapper-layer performance regressions surface before they
+ * reach production.
+ *
+ * Usage:
+ *   osrmc-bench <base_path> [options]
+ *     --threads N       worker threads issuing requests (default 4)
+ *     --requests N      requests per thread (default 1000)
+ *     --mix R:T:M:P:N:L relative weights for route:table:match:trip:nearest:tile
+ *                       (default 4:2:1:1:4:1; a weight of 0 disables a service)
+ *     --bbox a,b,c,d    sampling box as min_lon,min_lat,max_lon,max_lat
+ *                       (default 13.2,52.4,13.6,52.6 - Berlin)
+ *     --coords N        coordinates per route request (default 2)
+ *     --match-coords N  coordinates per match request (default 10)
+ *     --trip-coords N   coordinates per trip request (default 5)
+ *     --table-size N    coordinates per table request (default 10)
+ *     --seed S          RNG seed (default 42; each thread derives its own stream)
+ *
+ * Only the public C API and the C++ standard library are used, so the binary
+ * measures exactly what a foreign-function binding would see.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "osrmc.h"
+
+namespace {
+
+enum service_index {
+  SERVICE_ROUTE = 0,
+  SERVICE_TABLE,
+  SERVICE_MATCH,
+  SERVICE_TRIP,
+  SERVICE_NEAREST,
+  SERVICE_TILE,
+  SERVICE_COUNT
+};
+
+const char* const service_names[SERVICE_COUNT] = {"route", "table", "match", "trip", "nearest", "tile"};
+
+struct bench_options {
+  std::string base_path;
+  unsigned threads = 4;
+  unsigned requests = 1000;
+  unsigned weights[SERVICE_COUNT] = {4, 2, 1, 1, 4, 1};
+  double min_lon = 13.2;
+  double min_lat = 52.4;
+  double max_lon = 13.6;
+  double max_lat = 52.6;
+  unsigned route_coords = 2;
+  unsigned match_coords = 10;
+  unsigned trip_coords = 5;
+  unsigned table_coords = 10;
+  std::uint64_t seed = 42;
+};
+
+struct service_samples {
+  std::vector<double> latencies_us;
+  std::uint64_t errors = 0;
+};
+
+struct thread_samples {
+  service_samples services[SERVICE_COUNT];
+};
+
+void usage(const char* program) {
+  std::fprintf(stderr,
+               "Usage: %s <base_path> [--threads N] [--requests N] [--mix R:T:M:P:N:L]\n"
+               "          [--bbox min_lon,min_lat,max_lon,max_lat] [--coords N]\n"
+               "          [--match-coords N] [--trip-coords N] [--table-size N] [--seed S]\n",
+               program);
+}
+
+bool parse_options(int argc, char** argv, bench_options* options) {
+  if (argc < 2) {
+    return false;
+  }
+  options->base_path = argv[1];
+  for (int i = 2; i < argc; ++i) {
+    const std::string flag = argv[i];
+    const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (flag == "--threads" && value) {
+      options->threads = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+      ++i;
+    } else if (flag == "--requests" && value) {
+      options->requests = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+      ++i;
+    } else if (flag == "--mix" && value) {
+      if (std::sscanf(value, "%u:%u:%u:%u:%u:%u", &options->weights[0], &options->weights[1], &options->weights[2],
+                      &options->weights[3], &options->weights[4], &options->weights[5]) != 6) {
+        return false;
+      }
+      ++i;
+    } else if (flag == "--bbox" && value) {
+      if (std::sscanf(value, "%lf,%lf,%lf,%lf", &options->min_lon, &options->min_lat, &options->max_lon,
+                      &options->max_lat) != 4) {
+        return false;
+      }
+      ++i;
+    } else if (flag == "--coords" && value) {
+      options->route_coords = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+      ++i;
+    } else if (flag == "--match-coords" && value) {
+      options->match_coords = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+      ++i;
+    } else if (flag == "--trip-coords" && value) {
+      options->trip_coords = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+      ++i;
+    } else if (flag == "--table-size" && value) {
+      options->table_coords = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+      ++i;
+    } else if (flag == "--seed" && value) {
+      options->seed = std::strtoull(value, nullptr, 10);
+      ++i;
+    } else {
+      return false;
+    }
+  }
+  if (options->threads == 0 || options->requests == 0 || options->route_coords < 2 ||
+      options->match_coords < 2 || options->trip_coords < 2) {
+    return false;
+  }
+  return true;
+}
+
+bool consume_error(osrmc_error_t* error, service_samples* samples) {
+  if (!*error) {
+    return false;
+  }
+  ++samples->errors;
+  osrmc_error_destruct(*error);
+  *error = nullptr;
+  return true;
+}
+
+/* Slippy-map tile coordinates for a sampled point; keeps tile requests inside
+ * the same bounding box as the routing requests */
+void tile_for_coordinate(double lon, double lat, unsigned z, unsigned* x, unsigned* y) {
+  const double n = std::pow(2.0, static_cast<double>(z));
+  const double lat_rad = lat * M_PI / 180.0;
+  *x = static_cast<unsigned>(n * (lon + 180.0) / 360.0);
+  *y = static_cast<unsigned>(n * (1.0 - std::asinh(std::tan(lat_rad)) / M_PI) / 2.0);
+}
+
+void bench_thread(osrmc_osrm_t osrm, const bench_options& options, std::uint64_t seed, thread_samples* samples) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> lon_dist(options.min_lon, options.max_lon);
+  std::uniform_real_distribution<double> lat_dist(options.min_lat, options.max_lat);
+
+  unsigned total_weight = 0;
+  for (unsigned weight : options.weights) {
+    total_weight += weight;
+  }
+  std::uniform_int_distribution<unsigned> mix_dist(0, total_weight - 1);
+
+  for (unsigned request = 0; request < options.requests; ++request) {
+    unsigned draw = mix_dist(rng);
+    unsigned service = 0;
+    while (draw >= options.weights[service]) {
+      draw -= options.weights[service];
+      ++service;
+    }
+    auto* service_out = &samples->services[service];
+
+    osrmc_error_t error = nullptr;
+    const auto start = std::chrono::steady_clock::now();
+
+    switch (service) {
+      case SERVICE_ROUTE: {
+        auto params = osrmc_route_params_construct(&error);
+        if (consume_error(&error, service_out)) {
+          continue;
+        }
+        for (unsigned c = 0; c < options.route_coords && !error; ++c) {
+          osrmc_params_add_coordinate(reinterpret_cast<osrmc_params_t>(params), lon_dist(rng), lat_dist(rng), &error);
+        }
+        auto response = error ? nullptr : osrmc_route(osrm, params, &error);
+        if (response) {
+          osrmc_route_response_destruct(response);
+        }
+        osrmc_route_params_destruct(params);
+        break;
+      }
+      case SERVICE_TABLE: {
+        auto params = osrmc_table_params_construct(&error);
+        if (consume_error(&error, service_out)) {
+          continue;
+        }
+        for (unsigned c = 0; c < options.table_coords && !error; ++c) {
+          osrmc_params_add_coordinate(reinterpret_cast<osrmc_params_t>(params), lon_dist(rng), lat_dist(rng), &error);
+        }
+        auto response = error ? nullptr : osrmc_table(osrm, params, &error);
+        if (response) {
+          osrmc_table_response_destruct(response);
+        }
+        osrmc_table_params_destruct(params);
+        break;
+      }
+      case SERVICE_MATCH: {
+        auto params = osrmc_match_params_construct(&error);
+        if (consume_error(&error, service_out)) {
+          continue;
+        }
+        // A plausible trace: short steps from a random start, monotonic timestamps
+        double lon = lon_dist(rng);
+        double lat = lat_dist(rng);
+        std::uniform_real_distribution<double> step(-0.0005, 0.0005);
+        for (unsigned c = 0; c < options.match_coords && !error; ++c) {
+          osrmc_params_add_coordinate(reinterpret_cast<osrmc_params_t>(params), lon, lat, &error);
+          if (!error) {
+            osrmc_match_params_add_timestamp(params, 1600000000u + c * 5u, &error);
+          }
+          lon += step(rng);
+          lat += step(rng);
+        }
+        auto response = error ? nullptr : osrmc_match(osrm, params, &error);
+        if (response) {
+          osrmc_match_response_destruct(response);
+        }
+        osrmc_match_params_destruct(params);
+        break;
+      }
+      case SERVICE_TRIP: {
+        auto params = osrmc_trip_params_construct(&error);
+        if (consume_error(&error, service_out)) {
+          continue;
+        }
+        for (unsigned c = 0; c < options.trip_coords && !error; ++c) {
+          osrmc_params_add_coordinate(reinterpret_cast<osrmc_params_t>(params), lon_dist(rng), lat_dist(rng), &error);
+        }
+        auto response = error ? nullptr : osrmc_trip(osrm, params, &error);
+        if (response) {
+          osrmc_trip_response_destruct(response);
+        }
+        osrmc_trip_params_destruct(params);
+        break;
+      }
+      case SERVICE_NEAREST: {
+        auto params = osrmc_nearest_params_construct(&error);
+        if (consume_error(&error, service_out)) {
+          continue;
+        }
+        osrmc_params_add_coordinate(reinterpret_cast<osrmc_params_t>(params), lon_dist(rng), lat_dist(rng), &error);
+        auto response = error ? nullptr : osrmc_nearest(osrm, params, &error);
+        if (response) {
+          osrmc_nearest_response_destruct(response);
+        }
+        osrmc_nearest_params_destruct(params);
+        break;
+      }
+      case SERVICE_TILE: {
+        auto params = osrmc_tile_params_construct(&error);
+        if (consume_error(&error, service_out)) {
+          continue;
+        }
+        unsigned x = 0;
+        unsigned y = 0;
+        tile_for_coordinate(lon_dist(rng), lat_dist(rng), 15, &x, &y);
+        osrmc_tile_params_set_x(params, x, &error);
+        if (!error) {
+          osrmc_tile_params_set_y(params, y, &error);
+        }
+        if (!error) {
+          osrmc_tile_params_set_z(params, 15, &error);
+        }
+        auto response = error ? nullptr : osrmc_tile(osrm, params, &error);
+        if (response) {
+          osrmc_tile_response_destruct(response);
+        }
+        osrmc_tile_params_destruct(params);
+        break;
+      }
+      default:
+        break;
+    }
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    if (error) {
+      consume_error(&error, service_out);
+    } else {
+      service_out->latencies_us.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+    }
+  }
+}
+
+double percentile(const std::vector<double>& sorted, double fraction) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  auto index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1));
+  return sorted[index];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  bench_options options;
+  if (!parse_options(argc, argv, &options)) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  osrmc_error_t error = nullptr;
+  auto config = osrmc_config_construct(options.base_path.c_str(), &error);
+  if (error) {
+    std::fprintf(stderr, "config: %s\n", osrmc_error_message(error));
+    osrmc_error_destruct(error);
+    return EXIT_FAILURE;
+  }
+  auto osrm = osrmc_osrm_construct(config, &error);
+  osrmc_config_destruct(config);
+  if (error) {
+    std::fprintf(stderr, "engine: %s\n", osrmc_error_message(error));
+    osrmc_error_destruct(error);
+    return EXIT_FAILURE;
+  }
+
+  std::printf("osrmc-bench: %u threads x %u requests against %s\n", options.threads, options.requests,
+              options.base_path.c_str());
+
+#ifdef __GLIBC__
+  const auto heap_before = mallinfo2();
+#endif
+
+  std::vector<thread_samples> samples(options.threads);
+  std::vector<std::thread> workers;
+  workers.reserve(options.threads);
+  const auto wall_start = std::chrono::steady_clock::now();
+  for (unsigned t = 0; t < options.threads; ++t) {
+    workers.emplace_back(bench_thread, osrm, std::cref(options), options.seed + t, &samples[t]);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  const double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+#ifdef __GLIBC__
+  const auto heap_after = mallinfo2();
+#endif
+
+  std::uint64_t total_requests = 0;
+  std::uint64_t total_errors = 0;
+  std::printf("%-8s %10s %8s %12s %12s %12s %12s\n", "service", "requests", "errors", "p50(us)", "p95(us)", "p99(us)",
+              "p99.9(us)");
+  for (unsigned service = 0; service < SERVICE_COUNT; ++service) {
+    std::vector<double> merged;
+    std::uint64_t errors = 0;
+    for (const auto& thread : samples) {
+      const auto& bucket = thread.services[service];
+      merged.insert(merged.end(), bucket.latencies_us.begin(), bucket.latencies_us.end());
+      errors += bucket.errors;
+    }
+    total_requests += merged.size() + errors;
+    total_errors += errors;
+    if (merged.empty() && errors == 0) {
+      continue;
+    }
+    std::sort(merged.begin(), merged.end());
+    std::printf("%-8s %10zu %8llu %12.1f %12.1f %12.1f %12.1f\n", service_names[service], merged.size(),
+                static_cast<unsigned long long>(errors), percentile(merged, 0.50), percentile(merged, 0.95),
+                percentile(merged, 0.99), percentile(merged, 0.999));
+  }
+
+  std::printf("total: %llu requests (%llu errors) in %.2fs -> %.0f req/s\n",
+              static_cast<unsigned long long>(total_requests), static_cast<unsigned long long>(total_errors), wall_s,
+              wall_s > 0 ? static_cast<double>(total_requests) / wall_s : 0.0);
+#ifdef __GLIBC__
+  // Heap growth over the run divided by request count: an approximation (the
+  // allocator retains freed chunks) but steady enough to flag regressions
+  const auto heap_delta =
+      static_cast<long long>(heap_after.uordblks + heap_after.hblkhd) - static_cast<long long>(heap_before.uordblks + heap_before.hblkhd);
+  if (total_requests > 0) {
+    std::printf("heap delta: %lld bytes (%.1f bytes/request, approximate)\n", heap_delta,
+                static_cast<double>(heap_delta) / static_cast<double>(total_requests));
+  }
+#endif
+
+  osrmc_osrm_destruct(osrm);
+  return total_errors == total_requests && total_requests > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
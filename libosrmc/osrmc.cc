@@ -1,22 +1,47 @@
 // Standard library headers
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cctype>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <cstdlib>
+#include <cerrno>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
 
+// System headers (page cache warming)
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
 // OSRM backend headers
 #include <osrm/bearing.hpp>
 #include <osrm/coordinate.hpp>
 #include <osrm/engine/api/base_parameters.hpp>
 #include <osrm/engine/api/base_result.hpp>
+#include <osrm/engine/api/flatbuffers/fbresult_generated.h>
 #include <osrm/engine/hint.hpp>
 #include <osrm/engine_config.hpp>
 #include <osrm/json_container.hpp>
@@ -52,12 +77,746 @@ osrmc_is_abi_compatible(void) {
 struct osrmc_error final {
   std::string code;
   std::string message;
+  error_id_t id = ERROR_ID_UNKNOWN;
+  // Interned instances are static and must never be deleted
+  bool dynamic = true;
+};
+
+// Interned error table: the common OSRM service codes carry fixed boilerplate
+// messages, so failures with these codes can be reported through static
+// instances without touching the heap. Wrapper codes that carry a per-call
+// message (null canonical message) only get the numeric id.
+struct osrmc_error_intern_entry final {
+  const char* code;
+  error_id_t id;
+  const char* message;
+};
+
+static const osrmc_error_intern_entry osrmc_error_intern_table[] = {
+  {"InvalidUrl", ERROR_ID_INVALID_URL, "URL string is invalid"},
+  {"InvalidService", ERROR_ID_INVALID_SERVICE, "Service name is invalid"},
+  {"InvalidVersion", ERROR_ID_INVALID_VERSION, "Version is not found"},
+  {"InvalidOptions", ERROR_ID_INVALID_OPTIONS, "Options are invalid"},
+  {"InvalidQuery", ERROR_ID_INVALID_QUERY, "Query string is malformed"},
+  {"InvalidValue", ERROR_ID_INVALID_VALUE, "The successfully parsed query parameters are invalid"},
+  {"NoSegment", ERROR_ID_NO_SEGMENT, "One of the supplied input coordinates could not snap to a street segment"},
+  {"TooBig", ERROR_ID_TOO_BIG, "The request size violates one of the service specific request size restrictions"},
+  {"NoRoute", ERROR_ID_NO_ROUTE, "Impossible route between points"},
+  {"NoTable", ERROR_ID_NO_TABLE, "No table found"},
+  {"NotImplemented", ERROR_ID_NOT_IMPLEMENTED, "This request is not supported"},
+  {"NoMatch", ERROR_ID_NO_MATCH, "No matchings found"},
+  {"NoTrips", ERROR_ID_NO_TRIPS, "No trips found because input coordinates are not connected"},
+  {"InvalidArgument", ERROR_ID_INVALID_ARGUMENT, nullptr},
+  {"Timeout", ERROR_ID_TIMEOUT, nullptr},
+  {"Cancelled", ERROR_ID_CANCELLED, nullptr},
+};
+
+static constexpr size_t osrmc_error_intern_count = sizeof(osrmc_error_intern_table) / sizeof(osrmc_error_intern_table[0]);
+
+static size_t
+osrmc_error_intern_index(const char* code) {
+  for (size_t i = 0; i < osrmc_error_intern_count; ++i) {
+    if (std::strcmp(osrmc_error_intern_table[i].code, code) == 0) {
+      return i;
+    }
+  }
+  return osrmc_error_intern_count;
+}
+
+static const osrmc_error*
+osrmc_error_interned_instance(size_t table_index) {
+  static const auto instances = [] {
+    std::array<osrmc_error, osrmc_error_intern_count> out;
+    for (size_t i = 0; i < osrmc_error_intern_count; ++i) {
+      const auto& entry = osrmc_error_intern_table[i];
+      out[i] = osrmc_error{entry.code, entry.message ? entry.message : "", entry.id, false};
+    }
+    return out;
+  }();
+  return &instances[table_index];
+}
+
+// Builder pool: recycles flatbuffers::FlatBufferBuilder instances (and their
+// grown backing buffers) across requests instead of constructing a fresh one
+// per service call. The free list is thread-local, so acquire/release never
+// take a lock; a builder acquired on a worker thread and released on the
+// caller thread simply migrates between lists. Capped so idle threads do not
+// pin large buffers.
+// Bump allocator behind osrmc_arena_t. Serves the FlatBuffer builder's
+// internals for requests issued while the arena is installed on the calling
+// thread; a reset reclaims everything with one pointer store instead of n
+// frees. Allocations that do not fit fall back to the heap and are freed
+// individually, so an undersized arena degrades gracefully.
+class osrmc_arena final : public flatbuffers::Allocator {
+public:
+  explicit osrmc_arena(size_t bytes) : block_(bytes) {}
+
+  uint8_t* allocate(size_t size) override {
+    constexpr size_t alignment = alignof(std::max_align_t);
+    const size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+    if (size <= block_.size() && aligned <= block_.size() - size) {
+      offset_ = aligned + size;
+      return block_.data() + aligned;
+    }
+    ++overflow_;
+    return new uint8_t[size];
+  }
+
+  void deallocate(uint8_t* p, size_t size) override {
+    (void)size;
+    // In-arena memory is reclaimed wholesale by reset(); only overflow
+    // allocations are individually freed
+    if (p >= block_.data() && p < block_.data() + block_.size()) {
+      return;
+    }
+    delete[] p;
+  }
+
+  void reset() { offset_ = 0; }
+  size_t used() const { return offset_; }
+  size_t overflow() const { return overflow_; }
+
+private:
+  std::vector<uint8_t> block_;
+  size_t offset_ = 0;
+  size_t overflow_ = 0;
+};
+
+// The calling thread's installed arena, if any (osrmc_arena_install)
+static osrmc_arena*&
+osrmc_thread_arena() {
+  thread_local osrmc_arena* arena = nullptr;
+  return arena;
+}
+
+static std::vector<flatbuffers::FlatBufferBuilder>&
+osrmc_builder_pool() {
+  thread_local std::vector<flatbuffers::FlatBufferBuilder> pool;
+  return pool;
+}
+
+static flatbuffers::FlatBufferBuilder
+osrmc_builder_acquire(size_t size_hint = 0) {
+  if (auto* arena = osrmc_thread_arena()) {
+    // Arena-backed builders bypass the pool: their memory belongs to the
+    // arena and is reclaimed by its reset
+    return flatbuffers::FlatBufferBuilder(size_hint > 0 ? size_hint : 1024, arena, false);
+  }
+  auto& pool = osrmc_builder_pool();
+  if (!pool.empty()) {
+    // Pooled builders keep the capacity they grew to, so no pre-sizing needed
+    auto builder = std::move(pool.back());
+    pool.pop_back();
+    return builder;
+  }
+  return flatbuffers::FlatBufferBuilder(size_hint > 0 ? size_hint : 1024);
+}
+
+static void
+osrmc_builder_release(flatbuffers::FlatBufferBuilder&& builder) {
+  if (osrmc_thread_arena()) {
+    return;
+  }
+  constexpr size_t max_pooled_builders = 4;
+  auto& pool = osrmc_builder_pool();
+  if (pool.size() < max_pooled_builders) {
+    builder.Clear();
+    pool.push_back(std::move(builder));
+  }
+}
+
+// Per-thread running estimate of response sizes per service, used to pre-size
+// fresh builders when the caller gave no explicit hint. Thread-local, so no
+// synchronization on the hot path.
+static std::array<size_t, OSRMC_SERVICE_COUNT>&
+osrmc_response_size_estimates() {
+  thread_local std::array<size_t, OSRMC_SERVICE_COUNT> estimates{};
+  return estimates;
+}
+
+// Folds an observed response size into the estimate (EWMA, alpha 1/4)
+static void
+osrmc_response_size_observe_helper(osrmc_service_t service, size_t size) {
+  auto& estimate = osrmc_response_size_estimates()[static_cast<size_t>(service)];
+  estimate = estimate == 0 ? size : estimate - estimate / 4 + size / 4;
+}
+
+// Matrix assembled natively from parallel sub-table results. Responses
+// carrying one of these have no FlatBuffer and are read through the typed
+// table accessors only.
+struct osrmc_assembled_table final {
+  size_t rows = 0;
+  size_t cols = 0;
+  // Row-major, rows * cols when the annotation was requested, empty otherwise
+  std::vector<float> durations;
+  std::vector<float> distances;
 };
 
 struct osrmc_response final {
   osrm::engine::api::ResultT result;
+  // Set when the response was served from the result cache: the FlatBuffer
+  // lives in the shared cache payload instead of a builder
+  std::shared_ptr<const std::vector<uint8_t>> cached;
+  // Set for responses produced by osrmc_table_parallel()
+  std::unique_ptr<osrmc_assembled_table> assembled;
+  // Set when the builder's memory lives in an installed arena: such builders
+  // are never pooled and their payload is copied out on transfer
+  bool arena_backed = false;
+
+  // Return an unreleased builder to the pool so its buffer is recycled. After
+  // osrmc_*_response_transfer_flatbuffer() the buffer has already been handed
+  // to the caller and there is nothing left to recycle. Arena-backed builders
+  // are dropped instead; the arena reclaims their memory on reset.
+  ~osrmc_response() {
+    if (auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result)) {
+      if (!arena_backed) {
+        osrmc_builder_release(std::move(*builder));
+      }
+    }
+  }
+};
+
+// Internal worker pool: executes submitted tasks on a fixed set of threads.
+// Owned by the osrmc_osrm wrapper so batch submissions can fan out across
+// cores inside the library (osrm::OSRM is safe for concurrent service calls).
+class osrmc_worker_pool final {
+public:
+  explicit osrmc_worker_pool(unsigned thread_count) {
+    workers_.reserve(thread_count);
+    for (unsigned i = 0; i < thread_count; ++i) {
+      workers_.emplace_back([this] { run(); });
+    }
+  }
+
+  ~osrmc_worker_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  osrmc_worker_pool(const osrmc_worker_pool&) = delete;
+  osrmc_worker_pool& operator=(const osrmc_worker_pool&) = delete;
+
+  void submit(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+  }
+
+  unsigned size() const noexcept { return static_cast<unsigned>(workers_.size()); }
+
+private:
+  void run() {
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (stopping_ && tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+};
+
+// Wrapper behind osrmc_config_t: the engine configuration plus options that
+// belong to the wrapper layer rather than to osrm::EngineConfig itself
+struct osrmc_config final {
+  osrm::EngineConfig engine_config;
+  unsigned worker_threads = 0;
+  // Dataset base path as given at construction; empty for shared memory
+  std::string base_path;
+  prefault_policy_t prefault_policy = PREFAULT_NONE;
+};
+
+// Hint cache behind osrmc_hint_cache_t: maps quantized coordinates to the
+// snapping hints the engine returned for them. Sharded so concurrent service
+// calls mostly touch different locks, with shared locks on the read path.
+class osrmc_hint_cache final {
+public:
+  explicit osrmc_hint_cache(size_t capacity) : capacity_(std::max<size_t>(capacity, shard_count)) {}
+
+  std::optional<osrm::engine::Hint> lookup(const osrm::util::Coordinate& coordinate) {
+    const auto key = quantize(coordinate);
+    auto& shard = shards_[key % shard_count];
+    {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      const auto it = shard.entries.find(key);
+      if (it != shard.entries.end()) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second;
+      }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  void store(const osrm::util::Coordinate& coordinate, osrm::engine::Hint hint) {
+    const auto key = quantize(coordinate);
+    auto& shard = shards_[key % shard_count];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    // Per-shard capacity bound with cheap eviction: drop an arbitrary entry
+    // rather than tracking recency, which would put writes on the read path
+    if (shard.entries.size() >= capacity_ / shard_count && shard.entries.find(key) == shard.entries.end()) {
+      shard.entries.erase(shard.entries.begin());
+    }
+    shard.entries[key] = std::move(hint);
+  }
+
+  void clear() {
+    for (auto& shard : shards_) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.entries.clear();
+    }
+  }
+
+  void set_precision(unsigned decimal_digits) {
+    unsigned scale = 1;
+    for (unsigned i = decimal_digits; i < 6; ++i) {
+      scale *= 10;
+    }
+    for (auto& shard : shards_) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.entries.clear();
+    }
+    quantize_scale_.store(scale, std::memory_order_relaxed);
+  }
+
+  size_t entries() const {
+    size_t out = 0;
+    for (const auto& shard : shards_) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      out += shard.entries.size();
+    }
+    return out;
+  }
+
+  size_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  size_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+  static constexpr size_t shard_count = 16;
+
+  struct shard_type {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<uint64_t, osrm::engine::Hint> entries;
+  };
+
+  uint64_t quantize(const osrm::util::Coordinate& coordinate) const {
+    const auto scale = static_cast<std::int32_t>(quantize_scale_.load(std::memory_order_relaxed));
+    const auto lon = static_cast<std::int32_t>(coordinate.lon) / scale;
+    const auto lat = static_cast<std::int32_t>(coordinate.lat) / scale;
+    return (static_cast<uint64_t>(static_cast<uint32_t>(lon)) << 32) | static_cast<uint32_t>(lat);
+  }
+
+  std::array<shard_type, shard_count> shards_;
+  size_t capacity_;
+  // Divisor applied to fixed-precision coordinates; 10 ^ (6 - decimal_digits)
+  std::atomic<unsigned> quantize_scale_{10};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+};
+
+// Result cache behind osrmc_result_cache_t: maps a byte-serialized params
+// key to the finished FlatBuffer of an earlier identical request. Entries
+// expire after the configured TTL and the total payload size is bounded by an
+// approximate byte budget. Sharded like the hint cache so concurrent lookups
+// do not serialize behind a global lock; payloads are shared_ptrs, so a hit
+// can be served while the entry is concurrently evicted.
+class osrmc_result_cache final {
+public:
+  osrmc_result_cache(size_t max_bytes, int64_t ttl_ms) : max_bytes_(max_bytes), ttl_(ttl_ms) {}
+
+  std::shared_ptr<const std::vector<uint8_t>> lookup(const std::string& key) {
+    auto& shard = shards_[shard_index(key)];
+    {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      const auto it = shard.entries.find(key);
+      if (it != shard.entries.end() && std::chrono::steady_clock::now() < it->second.expires) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second.data;
+      }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  void store(const std::string& key, std::shared_ptr<const std::vector<uint8_t>> data) {
+    if (!data || data->size() > max_bytes_) {
+      return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    auto& shard = shards_[shard_index(key)];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    // Sweep expired entries of this shard, then evict arbitrary ones until
+    // the new payload fits the budget
+    for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+      if (now >= it->second.expires) {
+        bytes_.fetch_sub(it->second.data->size(), std::memory_order_relaxed);
+        it = shard.entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    while (bytes_.load(std::memory_order_relaxed) + data->size() > max_bytes_ && !shard.entries.empty()) {
+      auto it = shard.entries.begin();
+      bytes_.fetch_sub(it->second.data->size(), std::memory_order_relaxed);
+      shard.entries.erase(it);
+    }
+    const auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+      bytes_.fetch_sub(it->second.data->size(), std::memory_order_relaxed);
+    }
+    bytes_.fetch_add(data->size(), std::memory_order_relaxed);
+    shard.entries[key] = entry_type{std::move(data), now + ttl_};
+  }
+
+  void clear() {
+    for (auto& shard : shards_) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      for (const auto& [key, entry] : shard.entries) {
+        bytes_.fetch_sub(entry.data->size(), std::memory_order_relaxed);
+      }
+      shard.entries.clear();
+    }
+  }
+
+  size_t entries() const {
+    size_t out = 0;
+    for (const auto& shard : shards_) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      out += shard.entries.size();
+    }
+    return out;
+  }
+
+  size_t bytes() const { return bytes_.load(std::memory_order_relaxed); }
+  size_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  size_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+  static constexpr size_t shard_count = 16;
+
+  struct entry_type {
+    std::shared_ptr<const std::vector<uint8_t>> data;
+    std::chrono::steady_clock::time_point expires;
+  };
+
+  struct shard_type {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, entry_type> entries;
+  };
+
+  static size_t shard_index(const std::string& key) { return std::hash<std::string>{}(key) % shard_count; }
+
+  std::array<shard_type, shard_count> shards_;
+  size_t max_bytes_;
+  std::chrono::milliseconds ttl_;
+  std::atomic<size_t> bytes_{0};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+};
+
+// Tile response behind osrmc_tile_response_t: the rendered MVT payload,
+// shared with the tile cache when the tile was served from or stored into one
+struct osrmc_tile_response final {
+  std::shared_ptr<const std::string> data;
+};
+
+// Tile cache behind osrmc_tile_cache_t: LRU over rendered MVT payloads keyed
+// by packed z/x/y, bounded by a payload byte budget. A single mutex guards
+// the LRU list and index together; maintaining the recency order needs a
+// global structure anyway, and the critical section is tiny next to the MVT
+// rendering a hit saves. Payloads are shared_ptrs, so responses stay valid
+// after their entry is evicted.
+class osrmc_tile_cache final {
+public:
+  explicit osrmc_tile_cache(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+  static uint64_t key(unsigned x, unsigned y, unsigned z) {
+    return (static_cast<uint64_t>(z) << 58) | (static_cast<uint64_t>(x) << 29) | y;
+  }
+
+  std::shared_ptr<const std::string> lookup(uint64_t tile_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = index_.find(tile_key);
+    if (it == index_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    // Move to the front of the recency list
+    order_.splice(order_.begin(), order_, it->second.position);
+    ++hits_;
+    return it->second.data;
+  }
+
+  void store(uint64_t tile_key, std::shared_ptr<const std::string> data) {
+    if (!data || data->size() > max_bytes_) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = index_.find(tile_key);
+    if (it != index_.end()) {
+      bytes_ -= it->second.data->size();
+      order_.erase(it->second.position);
+      index_.erase(it);
+    }
+    while (bytes_ + data->size() > max_bytes_ && !order_.empty()) {
+      const auto victim = index_.find(order_.back());
+      bytes_ -= victim->second.data->size();
+      order_.pop_back();
+      index_.erase(victim);
+    }
+    bytes_ += data->size();
+    order_.push_front(tile_key);
+    index_[tile_key] = entry_type{std::move(data), order_.begin()};
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    order_.clear();
+    bytes_ = 0;
+  }
+
+  size_t entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.size();
+  }
+
+  size_t bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+  }
+
+  size_t hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  size_t misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+private:
+  struct entry_type {
+    std::shared_ptr<const std::string> data;
+    std::list<uint64_t>::iterator position;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, entry_type> index_;
+  std::list<uint64_t> order_;
+  size_t max_bytes_;
+  size_t bytes_ = 0;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+};
+
+// Wrapper behind osrmc_osrm_t: the engine plus the optional worker pool and
+// the optional caller-owned caches. The engine is held through a shared_ptr
+// so osrmc_osrm_reload() can swap in a new dataset while in-flight requests
+// keep the old engine alive until they drain; every service call snapshots
+// the pointer under the swap lock.
+// Per-handle runtime statistics. All counters are relaxed atomics and are only
+// touched when recording is enabled, so the hot-path cost is a single flag
+// load when disabled and a handful of uncontended atomic adds when enabled.
+struct osrmc_stats_counters final {
+  struct service_counters final {
+    std::atomic<unsigned long long> calls{0};
+    std::atomic<unsigned long long> errors{0};
+    std::atomic<unsigned long long> total_us{0};
+    std::atomic<unsigned long long> max_us{0};
+    std::atomic<unsigned long long> bytes_out{0};
+    std::array<std::atomic<unsigned long long>, OSRMC_STATS_HISTOGRAM_BUCKETS> latency_histogram{};
+  };
+
+  std::atomic<bool> enabled{false};
+  std::array<service_counters, OSRMC_SERVICE_COUNT> services{};
+
+  void record(osrmc_service_t service, unsigned long long us, unsigned long long bytes, bool failed) {
+    auto& counters = services[static_cast<size_t>(service)];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    if (failed) {
+      counters.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    counters.total_us.fetch_add(us, std::memory_order_relaxed);
+    auto observed_max = counters.max_us.load(std::memory_order_relaxed);
+    while (observed_max < us && !counters.max_us.compare_exchange_weak(observed_max, us, std::memory_order_relaxed)) {
+    }
+    if (bytes > 0) {
+      counters.bytes_out.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    const auto bucket =
+      us > 0 ? std::min<unsigned long long>(std::bit_width(us) - 1, OSRMC_STATS_HISTOGRAM_BUCKETS - 1) : 0;
+    counters.latency_histogram[static_cast<size_t>(bucket)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void reset() {
+    for (auto& counters : services) {
+      counters.calls.store(0, std::memory_order_relaxed);
+      counters.errors.store(0, std::memory_order_relaxed);
+      counters.total_us.store(0, std::memory_order_relaxed);
+      counters.max_us.store(0, std::memory_order_relaxed);
+      counters.bytes_out.store(0, std::memory_order_relaxed);
+      for (auto& bucket : counters.latency_histogram) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+};
+
+// RAII recorder: arm() starts the clock, the destructor books the sample. A
+// request counts as failed unless the success path says otherwise, so the
+// exception path of a function-try block is booked as an error too.
+struct osrmc_stats_scope final {
+  osrmc_stats_counters* counters = nullptr;
+  osrmc_service_t service = OSRMC_SERVICE_ROUTE;
+  std::chrono::steady_clock::time_point start{};
+  unsigned long long bytes = 0;
+  bool failed = true;
+
+  void arm(osrmc_stats_counters& target, osrmc_service_t kind) {
+    if (!target.enabled.load(std::memory_order_relaxed)) {
+      return;
+    }
+    counters = &target;
+    service = kind;
+    start = std::chrono::steady_clock::now();
+  }
+
+  ~osrmc_stats_scope() {
+    if (!counters) {
+      return;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    counters->record(service, static_cast<unsigned long long>(
+                                std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()),
+                     bytes, failed);
+  }
+};
+
+struct osrmc_osrm final {
+  std::shared_ptr<osrm::OSRM> engine;
+  mutable std::mutex engine_mutex;
+  std::unique_ptr<osrmc_worker_pool> pool;
+  osrmc_hint_cache* hint_cache = nullptr;
+  osrmc_result_cache* result_cache = nullptr;
+  osrmc_tile_cache* tile_cache = nullptr;
+  osrmc_stats_counters stats;
+  // Asynchronous construction state (osrmc_osrm_construct_async): ready flips
+  // once the background build finished, successfully or not
+  std::thread construction_thread;
+  std::condition_variable engine_condition;
+  bool ready = true;
+  osrmc_error_t construction_error = nullptr;
+
+  std::shared_ptr<osrm::OSRM> engine_snapshot() const {
+    std::lock_guard<std::mutex> lock(engine_mutex);
+    return engine;
+  }
+
+  ~osrmc_osrm() {
+    if (construction_thread.joinable()) {
+      construction_thread.join();
+    }
+    if (construction_error) {
+      osrmc_error_destruct(construction_error);
+    }
+  }
 };
 
+// One named dataset inside a registry. The once flag gates construction so
+// concurrent first lookups build the engine exactly once; a failure is kept
+// and re-reported on every later lookup of the name.
+struct osrmc_registry_entry final {
+  osrm::EngineConfig engine_config;
+  unsigned worker_threads = 0;
+  std::string base_path;
+  prefault_policy_t prefault_policy = PREFAULT_NONE;
+  std::once_flag built;
+  std::unique_ptr<osrmc_osrm> engine;
+  std::string failure_message;
+};
+
+// Registry behind osrmc_registry_t. The map itself is guarded by a shared
+// mutex: lookups after construction take only the shared side. Entries with
+// the same dataset identity share one underlying osrm::OSRM through the
+// dedup map, so one extract is resident once no matter how many names point
+// at it.
+struct osrmc_registry final {
+  mutable std::shared_mutex mutex;
+  std::unordered_map<std::string, std::unique_ptr<osrmc_registry_entry>> entries;
+  std::mutex dedup_mutex;
+  std::unordered_map<std::string, std::weak_ptr<osrm::OSRM>> dataset_engines;
+};
+
+// In-flight asynchronous service call. Reference counted so the handle can be
+// destructed by the caller while the worker task is still running: the task
+// holds its own reference and the last release frees untaken results.
+struct osrmc_request final {
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool complete = false;
+  void* response = nullptr;
+  void (*response_deleter)(void*) = nullptr;
+  osrmc_error_t request_error = nullptr;
+  osrmc_completion_t callback = nullptr;
+  void* user_data = nullptr;
+  std::atomic<bool> cancelled{false};
+  std::atomic<int> refs{2};
+
+  ~osrmc_request() {
+    if (response && response_deleter) {
+      response_deleter(response);
+    }
+    if (request_error) {
+      osrmc_error_destruct(request_error);
+    }
+  }
+};
+
+// Streaming match session behind osrmc_match_session_t: buffers incoming
+// trace points and matches them window by window through osrmc_match(), so
+// peak memory tracks the window size rather than the trace length
+struct osrmc_match_session final {
+  osrmc_osrm_t osrm = nullptr;
+  // Template params copied at construction; coordinates/timestamps are
+  // replaced per window
+  osrm::MatchParameters window_params;
+  std::vector<osrm::util::Coordinate> pending_coordinates;
+  std::vector<unsigned> pending_timestamps;
+  size_t window_size = 0;
+  size_t overlap = 0;
+  bool use_timestamps = false;
+  std::deque<osrmc_match_response_t> responses;
+};
+
+static void
+osrmc_request_release(osrmc_request* request) {
+  if (request->refs.fetch_sub(1) == 1) {
+    delete request;
+  }
+}
+
 
 /* Helpers */
 
@@ -65,8 +824,27 @@ struct osrmc_response final {
 static void
 osrmc_set_error(osrmc_error_t* error, const char* code, const char* message) {
   if (error) {
-    *error = new osrmc_error{code, message};
+    const auto index = osrmc_error_intern_index(code);
+    const auto id = index < osrmc_error_intern_count ? osrmc_error_intern_table[index].id : ERROR_ID_UNKNOWN;
+    *error = new osrmc_error{code, message, id};
+  }
+}
+
+// Allocation-free path for service failures: codes with a canonical message
+// are reported through a static interned instance, anything else falls back
+// to a dynamic error carrying the engine-provided message
+static void
+osrmc_set_error_interned(osrmc_error_t* error, const std::string& code, const std::string& message) {
+  if (!error) {
+    return;
   }
+  const auto index = osrmc_error_intern_index(code.c_str());
+  if (index < osrmc_error_intern_count && osrmc_error_intern_table[index].message) {
+    *error = const_cast<osrmc_error*>(osrmc_error_interned_instance(index));
+    return;
+  }
+  const auto id = index < osrmc_error_intern_count ? osrmc_error_intern_table[index].id : ERROR_ID_UNKNOWN;
+  *error = new osrmc_error{code, message, id};
 }
 
 static void
@@ -74,6 +852,22 @@ osrmc_error_from_exception(const std::exception& e, osrmc_error_t* error) {
   osrmc_set_error(error, "Exception", e.what());
 }
 
+// Copies a string into a caller buffer with NUL termination. out_needed
+// receives the required capacity in bytes including the terminator; fails
+// with BufferTooSmall when capacity is insufficient.
+static void
+osrmc_copy_string_helper(const std::string& value, char* buf, size_t capacity, size_t* out_needed, osrmc_error_t* error) {
+  const size_t needed = value.size() + 1;
+  if (out_needed) {
+    *out_needed = needed;
+  }
+  if (!buf || capacity < needed) {
+    osrmc_set_error(error, "BufferTooSmall", "Buffer capacity is less than the required size");
+    return;
+  }
+  std::memcpy(buf, value.c_str(), needed);
+}
+
 const char*
 osrmc_error_code(osrmc_error_t error) {
   return error ? error->code.c_str() : nullptr;
@@ -84,9 +878,14 @@ osrmc_error_message(osrmc_error_t error) {
   return error ? error->message.c_str() : nullptr;
 }
 
+error_id_t
+osrmc_error_id(osrmc_error_t error) {
+  return error ? error->id : ERROR_ID_UNKNOWN;
+}
+
 void
 osrmc_error_destruct(osrmc_error_t error) {
-  if (error) {
+  if (error && error->dynamic) {
     delete error;
   }
 }
@@ -97,6 +896,205 @@ osrmc_free_deleter(void* ptr) {
   std::free(ptr);
 }
 
+// Reset helpers: clear logical state while retaining vector capacity so a
+// recycled params object does not reallocate. Scalars are restored from a
+// default-constructed instance; the output format stays FlatBuffers.
+static void
+osrmc_reset_base_params_helper(osrm::engine::api::BaseParameters& params) {
+  const osrm::engine::api::BaseParameters defaults;
+  params.coordinates.clear();
+  params.hints.clear();
+  params.radiuses.clear();
+  params.bearings.clear();
+  params.approaches.clear();
+  params.exclude.clear();
+  params.generate_hints = defaults.generate_hints;
+  params.skip_waypoints = defaults.skip_waypoints;
+  params.snapping = defaults.snapping;
+}
+
+static void
+osrmc_reset_route_params_helper(osrm::RouteParameters& params) {
+  const osrm::RouteParameters defaults;
+  osrmc_reset_base_params_helper(params);
+  params.steps = defaults.steps;
+  params.alternatives = defaults.alternatives;
+  params.number_of_alternatives = defaults.number_of_alternatives;
+  params.annotations = defaults.annotations;
+  params.annotations_type = defaults.annotations_type;
+  params.geometries = defaults.geometries;
+  params.overview = defaults.overview;
+  params.continue_straight = defaults.continue_straight;
+  params.waypoints.clear();
+}
+
+// Per-params metadata registry. OSRM's parameter structs cannot carry
+// wrapper-level options such as deadlines, so these live in a registry keyed
+// by the params pointer and are erased when the params object is destructed.
+struct osrmc_params_metadata final {
+  int64_t timeout_ms = 0;
+  // Advisory immutability mark (osrmc_params_freeze): the wrapper itself
+  // never mutates frozen params, so they are safe to share across threads
+  bool frozen = false;
+  // Initial FlatBufferBuilder capacity for responses; 0 defers to the
+  // per-thread per-service estimate
+  size_t response_size_hint = 0;
+  // Soft time budget for osrmc_trip_parallel(); 0 means no budget
+  int64_t time_budget_ms = 0;
+};
+
+// Reads dominate: every service call consults the registry, while writes
+// only happen in setters and destructors, so the read path takes the lock
+// shared
+static std::shared_mutex osrmc_params_metadata_mutex;
+
+static std::unordered_map<const void*, osrmc_params_metadata>&
+osrmc_params_metadata_map() {
+  static std::unordered_map<const void*, osrmc_params_metadata> map;
+  return map;
+}
+
+static osrmc_params_metadata
+osrmc_params_metadata_get(const void* params) {
+  std::shared_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  auto& map = osrmc_params_metadata_map();
+  const auto it = map.find(params);
+  return it != map.end() ? it->second : osrmc_params_metadata{};
+}
+
+// Carries metadata over to a cloned params object. The frozen mark is not
+// copied: clones exist to be tweaked.
+static void
+osrmc_params_metadata_clone_helper(const void* source, const void* clone) {
+  std::unique_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  auto& map = osrmc_params_metadata_map();
+  const auto it = map.find(source);
+  if (it == map.end()) {
+    return;
+  }
+  auto copied = it->second;
+  copied.frozen = false;
+  map[clone] = copied;
+}
+
+static void
+osrmc_params_metadata_erase(const void* params) {
+  std::unique_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  osrmc_params_metadata_map().erase(params);
+}
+
+// Returns true and sets a Timeout error when the params' deadline has expired
+// relative to start, so queued work is shed before it touches the engine
+static bool
+osrmc_deadline_expired_helper(const void* params,
+                              std::chrono::steady_clock::time_point start,
+                              osrmc_error_t* error) {
+  const auto metadata = osrmc_params_metadata_get(params);
+  if (metadata.timeout_ms <= 0) {
+    return false;
+  }
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  if (elapsed.count() <= metadata.timeout_ms) {
+    return false;
+  }
+  osrmc_set_error(error, "Timeout", "Deadline expired before the request was executed");
+  return true;
+}
+
+// Egress helper: writes the payload straight from the response to a file
+// descriptor, skipping the ReleaseRaw/copy machinery of the transfer path.
+// writev() sends the optional 4-byte little-endian length prefix and the
+// payload in one syscall; the loop absorbs EINTR and short writes. The
+// response is left untouched, so it can still be read or transferred after.
+#ifndef _WIN32
+static void
+osrmc_response_write_fd_helper(osrmc_response* resp,
+                               int fd,
+                               int length_prefix,
+                               size_t* out_written,
+                               osrmc_error_t* error) {
+  if (out_written) {
+    *out_written = 0;
+  }
+  if (!resp) {
+    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
+    return;
+  }
+  const uint8_t* data = nullptr;
+  size_t size = 0;
+  if (resp->cached) {
+    data = resp->cached->data();
+    size = resp->cached->size();
+  } else if (const auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&resp->result)) {
+    data = builder->GetBufferPointer();
+    size = builder->GetSize();
+  } else {
+    osrmc_set_error(error, "InvalidFormat", "Response is not in FlatBuffer format");
+    return;
+  }
+
+  uint8_t prefix[4] = {0, 0, 0, 0};
+  size_t prefix_size = 0;
+  if (length_prefix) {
+    const auto payload_size = static_cast<uint32_t>(size);
+    prefix[0] = static_cast<uint8_t>(payload_size);
+    prefix[1] = static_cast<uint8_t>(payload_size >> 8);
+    prefix[2] = static_cast<uint8_t>(payload_size >> 16);
+    prefix[3] = static_cast<uint8_t>(payload_size >> 24);
+    prefix_size = sizeof(prefix);
+  }
+
+  size_t sent = 0;
+  const size_t total = prefix_size + size;
+  while (sent < total) {
+    struct iovec iov[2];
+    int iov_count = 0;
+    if (sent < prefix_size) {
+      iov[iov_count].iov_base = prefix + sent;
+      iov[iov_count].iov_len = prefix_size - sent;
+      ++iov_count;
+    }
+    const size_t payload_sent = sent > prefix_size ? sent - prefix_size : 0;
+    if (payload_sent < size) {
+      iov[iov_count].iov_base = const_cast<uint8_t*>(data) + payload_sent;
+      iov[iov_count].iov_len = size - payload_sent;
+      ++iov_count;
+    }
+    const ssize_t written = ::writev(fd, iov, iov_count);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      osrmc_set_error(error, "IOError", std::strerror(errno));
+      break;
+    }
+    if (written == 0) {
+      osrmc_set_error(error, "IOError", "Descriptor accepted no bytes");
+      break;
+    }
+    sent += static_cast<size_t>(written);
+  }
+  if (out_written) {
+    *out_written = sent;
+  }
+}
+#else
+static void
+osrmc_response_write_fd_helper(osrmc_response* resp,
+                               int fd,
+                               int length_prefix,
+                               size_t* out_written,
+                               osrmc_error_t* error) {
+  (void)resp;
+  (void)fd;
+  (void)length_prefix;
+  if (out_written) {
+    *out_written = 0;
+  }
+  osrmc_set_error(error, "NotImplemented", "write_fd is not available on Windows");
+}
+#endif
+
 // Transfer helper for FlatBuffer responses
 static void
 osrmc_transfer_flatbuffer_helper(osrmc_response* resp,
@@ -111,6 +1109,27 @@ osrmc_transfer_flatbuffer_helper(osrmc_response* resp,
     if (deleter) *deleter = nullptr;
     return;
   }
+  if (resp->cached) {
+    // Cached responses have no builder to release; hand out a copy so the
+    // ownership contract matches the builder path
+    uint8_t* copied_data = static_cast<uint8_t*>(std::malloc(resp->cached->size()));
+    if (!copied_data) {
+      osrmc_set_error(error, "MemoryError", "Failed to allocate memory for FlatBuffer data");
+      if (data)
+        *data = nullptr;
+      if (size)
+        *size = 0;
+      if (deleter)
+        *deleter = nullptr;
+      return;
+    }
+    std::memcpy(copied_data, resp->cached->data(), resp->cached->size());
+    *data = copied_data;
+    *size = resp->cached->size();
+    *deleter = osrmc_free_deleter;
+    resp->cached.reset();
+    return;
+  }
   if (!std::holds_alternative<flatbuffers::FlatBufferBuilder>(resp->result)) {
     osrmc_set_error(error, "InvalidFormat", "Response is not in FlatBuffer format");
     if (data)
@@ -123,13 +1142,35 @@ osrmc_transfer_flatbuffer_helper(osrmc_response* resp,
   }
   auto& builder = std::get<flatbuffers::FlatBufferBuilder>(resp->result);
 
-  // Release buffer from builder (move semantics)
-  // ReleaseRaw returns raw buffer and offset
-  size_t buffer_offset = 0;
-  size_t buffer_size = 0;
-  uint8_t* raw_buffer_ptr = builder.ReleaseRaw(buffer_size, buffer_offset);
-  uint8_t* data_ptr = raw_buffer_ptr + buffer_offset;
-
+  if (resp->arena_backed) {
+    // The payload lives in the arena and cannot outlive it; hand the caller
+    // a heap copy so the usual ownership contract holds
+    const size_t data_size = builder.GetSize();
+    uint8_t* copied_data = static_cast<uint8_t*>(std::malloc(data_size));
+    if (!copied_data) {
+      osrmc_set_error(error, "MemoryError", "Failed to allocate memory for FlatBuffer data");
+      if (data)
+        *data = nullptr;
+      if (size)
+        *size = 0;
+      if (deleter)
+        *deleter = nullptr;
+      return;
+    }
+    std::memcpy(copied_data, builder.GetBufferPointer(), data_size);
+    *data = copied_data;
+    *size = data_size;
+    *deleter = osrmc_free_deleter;
+    return;
+  }
+
+  // Release buffer from builder (move semantics)
+  // ReleaseRaw returns raw buffer and offset
+  size_t buffer_offset = 0;
+  size_t buffer_size = 0;
+  uint8_t* raw_buffer_ptr = builder.ReleaseRaw(buffer_size, buffer_offset);
+  uint8_t* data_ptr = raw_buffer_ptr + buffer_offset;
+
   if (buffer_offset == 0) {
     // Zero-copy case: data starts at the beginning of the buffer
     // Set deleter to free the raw buffer
@@ -165,672 +1206,2182 @@ osrmc_transfer_flatbuffer_helper(osrmc_response* resp,
     // Set deleter to free the copied data
     *deleter = osrmc_free_deleter;
 
-    // Transfer ownership of copied data
-    *data = copied_data;
-    *size = data_size;
+    // Transfer ownership of copied data
+    *data = copied_data;
+    *size = data_size;
+  }
+
+  // Clear result
+  resp->result = osrm::json::Object();
+}
+
+// View helper for FlatBuffer responses: exposes the finished buffer in place,
+// without releasing it from the builder. The pointer stays valid until the
+// response is destructed, mirroring the osrmc_tile_response_data() contract.
+static void
+osrmc_response_data_helper(osrmc_response* resp, const uint8_t** data, size_t* size, osrmc_error_t* error) {
+  if (!resp) {
+    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
+    if (data)
+      *data = nullptr;
+    if (size)
+      *size = 0;
+    return;
+  }
+  if (!data || !size) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
+    return;
+  }
+  if (resp->cached) {
+    *data = resp->cached->data();
+    *size = resp->cached->size();
+    return;
+  }
+  if (!std::holds_alternative<flatbuffers::FlatBufferBuilder>(resp->result)) {
+    osrmc_set_error(error, "InvalidFormat", "Response is not in FlatBuffer format");
+    *data = nullptr;
+    *size = 0;
+    return;
+  }
+  auto& builder = std::get<flatbuffers::FlatBufferBuilder>(resp->result);
+  *data = builder.GetBufferPointer();
+  *size = builder.GetSize();
+}
+
+// Hint cache integration: inject cached hints for coordinates that have none,
+// and refill the cache from the waypoint hints of a successful response
+static void
+osrmc_hint_cache_inject_helper(osrmc_hint_cache& cache, osrm::engine::api::BaseParameters& params) {
+  if (params.hints.size() < params.coordinates.size()) {
+    params.hints.resize(params.coordinates.size());
+  }
+  for (size_t i = 0; i < params.coordinates.size(); ++i) {
+    if (params.hints[i]) {
+      continue;
+    }
+    if (auto hint = cache.lookup(params.coordinates[i])) {
+      params.hints[i] = std::move(*hint);
+    }
+  }
+}
+
+static void
+osrmc_hint_cache_refill_helper(osrmc_hint_cache& cache,
+                               const osrm::engine::api::BaseParameters& params,
+                               const osrm::engine::api::ResultT& result) {
+  if (!params.generate_hints) {
+    return;
+  }
+  const auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result);
+  if (!builder) {
+    return;
+  }
+  const auto* fb_result = osrm::engine::api::fbresult::GetFBResult(builder->GetBufferPointer());
+  const auto* waypoints = fb_result && !fb_result->error() ? fb_result->waypoints() : nullptr;
+  // Waypoints align with the input coordinates only when the counts match
+  // (nearest candidate lists, for example, do not)
+  if (!waypoints || waypoints->size() != params.coordinates.size()) {
+    return;
+  }
+  for (uint32_t i = 0; i < waypoints->size(); ++i) {
+    const auto* waypoint = waypoints->Get(i);
+    const auto* hint = waypoint ? waypoint->hint() : nullptr;
+    if (!hint || hint->size() == 0) {
+      continue;
+    }
+    try {
+      cache.store(params.coordinates[i], osrm::engine::Hint::FromBase64(hint->c_str()));
+    } catch (const std::exception&) {
+      // Malformed hint: skip it, cache maintenance must never fail the request
+    }
+  }
+}
+
+// Result cache keys: a byte-serialized dump of every request-relevant field
+// of the params object. Full serialization rather than a hash alone, so two
+// distinct requests can never collide into the same cached response.
+static void
+osrmc_cache_key_bytes(std::string& key, const void* data, size_t size) {
+  key.append(static_cast<const char*>(data), size);
+}
+
+template<typename T>
+static void
+osrmc_cache_key_scalar(std::string& key, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  osrmc_cache_key_bytes(key, &value, sizeof(value));
+}
+
+template<typename T>
+static void
+osrmc_cache_key_optional(std::string& key, const std::optional<T>& value) {
+  osrmc_cache_key_scalar(key, value.has_value());
+  if (value) {
+    osrmc_cache_key_scalar(key, *value);
+  }
+}
+
+static void
+osrmc_cache_key_params(std::string& key, const osrm::engine::api::BaseParameters& params) {
+  osrmc_cache_key_scalar(key, params.coordinates.size());
+  for (const auto& coordinate : params.coordinates) {
+    osrmc_cache_key_scalar(key, static_cast<std::int32_t>(coordinate.lon));
+    osrmc_cache_key_scalar(key, static_cast<std::int32_t>(coordinate.lat));
+  }
+  osrmc_cache_key_scalar(key, params.radiuses.size());
+  for (const auto& radius : params.radiuses) {
+    osrmc_cache_key_optional(key, radius);
+  }
+  osrmc_cache_key_scalar(key, params.bearings.size());
+  for (const auto& bearing : params.bearings) {
+    osrmc_cache_key_optional(key, bearing);
+  }
+  osrmc_cache_key_scalar(key, params.approaches.size());
+  for (const auto& approach : params.approaches) {
+    osrmc_cache_key_optional(key, approach);
+  }
+  osrmc_cache_key_scalar(key, params.exclude.size());
+  for (const auto& exclude_profile : params.exclude) {
+    osrmc_cache_key_scalar(key, exclude_profile.size());
+    osrmc_cache_key_bytes(key, exclude_profile.data(), exclude_profile.size());
+  }
+  osrmc_cache_key_scalar(key, params.generate_hints);
+  osrmc_cache_key_scalar(key, params.skip_waypoints);
+  osrmc_cache_key_scalar(key, params.snapping);
+}
+
+static void
+osrmc_cache_key_params(std::string& key, const osrm::NearestParameters& params) {
+  osrmc_cache_key_params(key, static_cast<const osrm::engine::api::BaseParameters&>(params));
+  osrmc_cache_key_scalar(key, params.number_of_results);
+}
+
+static void
+osrmc_cache_key_params(std::string& key, const osrm::RouteParameters& params) {
+  osrmc_cache_key_params(key, static_cast<const osrm::engine::api::BaseParameters&>(params));
+  osrmc_cache_key_scalar(key, params.steps);
+  osrmc_cache_key_scalar(key, params.alternatives);
+  osrmc_cache_key_scalar(key, params.number_of_alternatives);
+  osrmc_cache_key_scalar(key, params.annotations);
+  osrmc_cache_key_scalar(key, params.annotations_type);
+  osrmc_cache_key_scalar(key, params.geometries);
+  osrmc_cache_key_scalar(key, params.overview);
+  osrmc_cache_key_optional(key, params.continue_straight);
+  osrmc_cache_key_scalar(key, params.waypoints.size());
+  for (const auto& waypoint : params.waypoints) {
+    osrmc_cache_key_scalar(key, waypoint);
+  }
+}
+
+static void
+osrmc_cache_key_params(std::string& key, const osrm::TableParameters& params) {
+  osrmc_cache_key_params(key, static_cast<const osrm::engine::api::BaseParameters&>(params));
+  osrmc_cache_key_scalar(key, params.sources.size());
+  for (const auto& source : params.sources) {
+    osrmc_cache_key_scalar(key, source);
+  }
+  osrmc_cache_key_scalar(key, params.destinations.size());
+  for (const auto& destination : params.destinations) {
+    osrmc_cache_key_scalar(key, destination);
+  }
+  osrmc_cache_key_scalar(key, params.annotations);
+  osrmc_cache_key_scalar(key, params.fallback_speed);
+  osrmc_cache_key_scalar(key, params.fallback_coordinate_type);
+  osrmc_cache_key_scalar(key, params.scale_factor);
+}
+
+static void
+osrmc_cache_key_params(std::string& key, const osrm::MatchParameters& params) {
+  osrmc_cache_key_params(key, static_cast<const osrm::RouteParameters&>(params));
+  osrmc_cache_key_scalar(key, params.timestamps.size());
+  for (const auto& timestamp : params.timestamps) {
+    osrmc_cache_key_scalar(key, timestamp);
+  }
+  osrmc_cache_key_scalar(key, params.gaps);
+  osrmc_cache_key_scalar(key, params.tidy);
+}
+
+static void
+osrmc_cache_key_params(std::string& key, const osrm::TripParameters& params) {
+  osrmc_cache_key_params(key, static_cast<const osrm::RouteParameters&>(params));
+  osrmc_cache_key_scalar(key, params.roundtrip);
+  osrmc_cache_key_scalar(key, params.source);
+  osrmc_cache_key_scalar(key, params.destination);
+}
+
+// Service helpers
+template<typename ParamsHandle, typename ParamsType, typename ResponseHandle, typename MethodFunc>
+static ResponseHandle
+osrmc_service_helper(osrmc_osrm_t osrm,
+                     ParamsHandle params,
+                     MethodFunc method,
+                     osrmc_service_t service,
+                     const char* error_name,
+                     osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return nullptr;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
+  const auto engine = wrapper->engine_snapshot();
+  auto* osrm_typed = engine.get();
+  if (!osrm_typed) {
+    osrmc_set_error(error, "NotReady", "Engine is still loading");
+    return nullptr;
+  }
+  auto* params_typed = reinterpret_cast<ParamsType*>(params);
+
+  osrmc_stats_scope stats;
+  stats.arm(wrapper->stats, service);
+  const auto metadata = osrmc_params_metadata_get(params);
+
+  if constexpr (std::is_base_of_v<osrm::engine::api::BaseParameters, ParamsType>) {
+    // Frozen params are shared read-only across threads, so no hint injection
+    if (wrapper->hint_cache && !metadata.frozen) {
+      osrmc_hint_cache_inject_helper(*wrapper->hint_cache, *params_typed);
+    }
+  }
+
+  std::string cache_key;
+  if constexpr (std::is_base_of_v<osrm::engine::api::BaseParameters, ParamsType>) {
+    if (wrapper->result_cache) {
+      cache_key.append(error_name);
+      osrmc_cache_key_params(cache_key, *params_typed);
+      if (auto cached = wrapper->result_cache->lookup(cache_key)) {
+        stats.failed = false;
+        stats.bytes = cached->size();
+        auto* out = new osrmc_response{osrm::json::Object(), std::move(cached), {}, false};
+        return reinterpret_cast<ResponseHandle>(out);
+      }
+    }
+  }
+
+  // Always use FlatBuffer format; the builder comes from the per-thread pool.
+  // A fresh builder is pre-sized by the caller's hint or the running estimate
+  // for this service, so annotation-heavy responses skip the regrowth cycles.
+  const auto size_hint = metadata.response_size_hint > 0
+                           ? metadata.response_size_hint
+                           : osrmc_response_size_estimates()[static_cast<size_t>(service)];
+  osrm::engine::api::ResultT result = osrmc_builder_acquire(size_hint);
+  const auto status = method(*osrm_typed, *params_typed, result);
+
+  if (status == osrm::Status::Ok) {
+    if constexpr (std::is_base_of_v<osrm::engine::api::BaseParameters, ParamsType>) {
+      if (wrapper->hint_cache) {
+        osrmc_hint_cache_refill_helper(*wrapper->hint_cache, *params_typed, result);
+      }
+      if (wrapper->result_cache && !cache_key.empty()) {
+        if (const auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result)) {
+          const auto* begin = builder->GetBufferPointer();
+          wrapper->result_cache->store(
+            cache_key, std::make_shared<const std::vector<uint8_t>>(begin, begin + builder->GetSize()));
+        }
+      }
+    }
+    stats.failed = false;
+    if (const auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result)) {
+      stats.bytes = builder->GetSize();
+      osrmc_response_size_observe_helper(service, builder->GetSize());
+    }
+    auto* out = new osrmc_response{std::move(result), {}, {}, osrmc_thread_arena() != nullptr};
+    return reinterpret_cast<ResponseHandle>(out);
+  }
+
+  // Extract error from response, fallback to generic error
+  try {
+    if (error) {
+      // Errors are returned as JSON even when format is flatbuffers
+      // Try to extract error from result if it's JSON (for error responses)
+      if (std::holds_alternative<osrm::json::Object>(result)) {
+        auto& json = std::get<osrm::json::Object>(result);
+        auto code_it = json.values.find("code");
+        auto msg_it = json.values.find("message");
+        if (code_it != json.values.end() &&
+            std::holds_alternative<osrm::json::String>(code_it->second) &&
+            msg_it != json.values.end() &&
+            std::holds_alternative<osrm::json::String>(msg_it->second)) {
+          const auto& code = std::get<osrm::json::String>(code_it->second).value;
+          const auto& message = std::get<osrm::json::String>(msg_it->second).value;
+          if (code.empty()) {
+            osrmc_set_error(error, "Unknown", message.c_str());
+          } else {
+            osrmc_set_error_interned(error, code, message);
+          }
+        } else {
+          osrmc_set_error(error, error_name, "Request failed");
+        }
+      } else {
+        osrmc_set_error(error, error_name, "Request failed");
+      }
+    }
+  } catch (...) {
+    osrmc_set_error(error, error_name, "Request failed");
+  }
+  return nullptr;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+// Batch helper: runs count requests through osrmc_service_helper in one call,
+// reporting per-request results through parallel response/error arrays
+template<typename ParamsHandle, typename ParamsType, typename ResponseHandle, typename MethodFunc>
+static void
+osrmc_batch_helper(osrmc_osrm_t osrm,
+                   const ParamsHandle* params,
+                   size_t count,
+                   ResponseHandle* responses_out,
+                   osrmc_error_t* errors_out,
+                   MethodFunc method,
+                   osrmc_service_t service,
+                   const char* error_name,
+                   osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return;
+  }
+  if (count == 0) {
+    return;
+  }
+  if (!params || !responses_out || !errors_out) {
+    osrmc_set_error(error, "InvalidArgument", "Batch arrays must not be null");
+    return;
+  }
+
+  const auto batch_start = std::chrono::steady_clock::now();
+  auto run_one = [&](size_t i) {
+    errors_out[i] = nullptr;
+    responses_out[i] = nullptr;
+    if (osrmc_deadline_expired_helper(params[i], batch_start, &errors_out[i])) {
+      return;
+    }
+    responses_out[i] =
+      osrmc_service_helper<ParamsHandle, ParamsType, ResponseHandle>(osrm, params[i], method, service,
+                                                                     error_name, &errors_out[i]);
+  };
+
+  // Fan out across the worker pool when the osrm handle owns one
+  // (osrmc_config_set_worker_threads), otherwise run inline
+  auto* pool = reinterpret_cast<osrmc_osrm*>(osrm)->pool.get();
+  if (pool && count > 1) {
+    const auto task_count = std::min<size_t>(pool->size(), count);
+    std::atomic<size_t> next_index{0};
+    std::mutex done_mutex;
+    std::condition_variable done_condition;
+    size_t remaining = task_count;
+
+    auto drain = [&] {
+      for (size_t i = next_index.fetch_add(1); i < count; i = next_index.fetch_add(1)) {
+        run_one(i);
+      }
+      {
+        std::lock_guard<std::mutex> lock(done_mutex);
+        --remaining;
+      }
+      done_condition.notify_one();
+    };
+    for (size_t t = 0; t < task_count; ++t) {
+      pool->submit(drain);
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_condition.wait(lock, [&] { return remaining == 0; });
+    return;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    run_one(i);
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+// Submit helper: enqueues a service call on the worker pool and returns a
+// request handle. The sync functor runs the service and returns the response
+// handle; the deleter matches the service's response destructor so untaken
+// results can be freed on release.
+template<typename SyncFunc>
+static osrmc_request_t
+osrmc_submit_helper(osrmc_osrm_t osrm,
+                    const void* params,
+                    SyncFunc sync,
+                    void (*response_deleter)(void*),
+                    osrmc_completion_t callback,
+                    void* user_data,
+                    osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return nullptr;
+  }
+  auto* pool = reinterpret_cast<osrmc_osrm*>(osrm)->pool.get();
+  if (!pool) {
+    osrmc_set_error(error, "NoWorkerPool", "Asynchronous submission requires osrmc_config_set_worker_threads");
+    return nullptr;
+  }
+
+  auto* request = new osrmc_request;
+  request->response_deleter = response_deleter;
+  request->callback = callback;
+  request->user_data = user_data;
+
+  const auto submitted = std::chrono::steady_clock::now();
+  pool->submit([request, params, sync, submitted] {
+    osrmc_error_t task_error = nullptr;
+    void* response = nullptr;
+    if (request->cancelled.load(std::memory_order_acquire)) {
+      osrmc_set_error(&task_error, "Cancelled", "Request was cancelled before it was executed");
+    } else if (!osrmc_deadline_expired_helper(params, submitted, &task_error)) {
+      response = sync(&task_error);
+    }
+    osrmc_completion_t completion = nullptr;
+    void* completion_data = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(request->mutex);
+      request->response = response;
+      request->request_error = task_error;
+      request->complete = true;
+      completion = request->callback;
+      completion_data = request->user_data;
+    }
+    request->condition.notify_all();
+    if (completion) {
+      completion(reinterpret_cast<osrmc_request_t>(request), completion_data);
+    }
+    osrmc_request_release(request);
+  });
+
+  return reinterpret_cast<osrmc_request_t>(request);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+/* Config */
+
+osrmc_config_t
+osrmc_config_construct(const char* base_path, osrmc_error_t* error) try {
+  auto* out = new osrmc_config;
+
+  if (base_path) {
+    out->engine_config.storage_config = osrm::StorageConfig(std::filesystem::path(base_path));
+    out->engine_config.use_shared_memory = false;
+    out->base_path = base_path;
+  } else {
+    out->engine_config.use_shared_memory = true;
+  }
+
+  return reinterpret_cast<osrmc_config_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_config_destruct(osrmc_config_t config) {
+  if (config) {
+    delete reinterpret_cast<osrmc_config*>(config);
+  }
+}
+
+void
+osrmc_config_set_max_locations_trip(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_locations_trip = max_locations;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_locations_trip(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
+  if (!out_max_locations) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_locations = config_typed->max_locations_trip;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_max_locations_viaroute(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_locations_viaroute = max_locations;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_locations_viaroute(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
+  if (!out_max_locations) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_locations = config_typed->max_locations_viaroute;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_max_locations_distance_table(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_locations_distance_table = max_locations;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_locations_distance_table(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
+  if (!out_max_locations) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_locations = config_typed->max_locations_distance_table;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_max_locations_map_matching(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_locations_map_matching = max_locations;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_locations_map_matching(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
+  if (!out_max_locations) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_locations = config_typed->max_locations_map_matching;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_max_radius_map_matching(osrmc_config_t config, double max_radius, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_radius_map_matching = max_radius;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_radius_map_matching(osrmc_config_t config, double* out_max_radius, osrmc_error_t* error) try {
+  if (!out_max_radius) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_radius = config_typed->max_radius_map_matching;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_max_results_nearest(osrmc_config_t config, int max_results, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_results_nearest = max_results;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_results_nearest(osrmc_config_t config, int* out_max_results, osrmc_error_t* error) try {
+  if (!out_max_results) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_results = config_typed->max_results_nearest;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_default_radius(osrmc_config_t config, double default_radius, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->default_radius = default_radius;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_default_radius(osrmc_config_t config, double* out_default_radius, osrmc_error_t* error) try {
+  if (!out_default_radius) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_default_radius = config_typed->default_radius;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_max_alternatives(osrmc_config_t config, int max_alternatives, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->max_alternatives = max_alternatives;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_max_alternatives(osrmc_config_t config, int* out_max_alternatives, osrmc_error_t* error) try {
+  if (!out_max_alternatives) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_max_alternatives = config_typed->max_alternatives;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_use_shared_memory(osrmc_config_t config, bool use_shared_memory, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->use_shared_memory = use_shared_memory;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_use_shared_memory(osrmc_config_t config, bool* out_use_shared_memory, osrmc_error_t* error) try {
+  if (!out_use_shared_memory) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_use_shared_memory = config_typed->use_shared_memory;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_memory_file(osrmc_config_t config, const char* memory_file, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  if (memory_file) {
+    config_typed->memory_file = std::filesystem::path(memory_file);
+  } else {
+    config_typed->memory_file.clear();
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_memory_file(osrmc_config_t config, const char** out_memory_file, osrmc_error_t* error) try {
+  if (!out_memory_file) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  // On Windows, path::c_str() returns wchar_t*, so we need to convert to string first
+  thread_local static std::string memory_file_str;
+  memory_file_str = config_typed->memory_file.string();
+  *out_memory_file = memory_file_str.c_str();
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_memory_file_buf(osrmc_config_t config,
+                                 char* buf,
+                                 size_t capacity,
+                                 size_t* out_needed,
+                                 osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  // On Windows, path::c_str() returns wchar_t*, so we need to convert to string first
+  osrmc_copy_string_helper(config_typed->memory_file.string(), buf, capacity, out_needed, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_prefault_policy(osrmc_config_t config, prefault_policy_t policy, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  if (policy != PREFAULT_NONE && policy != PREFAULT_READAHEAD && policy != PREFAULT_FULL) {
+    osrmc_set_error(error, "InvalidArgument", "Unknown prefault policy");
+    return;
+  }
+  reinterpret_cast<osrmc_config*>(config)->prefault_policy = policy;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_prefault_policy(osrmc_config_t config, prefault_policy_t* out_policy, osrmc_error_t* error) try {
+  if (!out_policy) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  *out_policy = reinterpret_cast<osrmc_config*>(config)->prefault_policy;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_use_mmap(osrmc_config_t config, bool use_mmap, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->use_mmap = use_mmap;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_use_mmap(osrmc_config_t config, bool* out_use_mmap, osrmc_error_t* error) try {
+  if (!out_use_mmap) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_use_mmap = config_typed->use_mmap;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_algorithm(osrmc_config_t config, algorithm_t algorithm, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+
+  switch (algorithm) {
+    case ALGORITHM_CH:
+      config_typed->algorithm = osrm::EngineConfig::Algorithm::CH;
+      break;
+    case ALGORITHM_MLD:
+      config_typed->algorithm = osrm::EngineConfig::Algorithm::MLD;
+      break;
+    default:
+      osrmc_set_error(error, "InvalidAlgorithm", "Unknown algorithm type");
+      return;
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_algorithm(osrmc_config_t config, algorithm_t* out_algorithm, osrmc_error_t* error) try {
+  if (!out_algorithm) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  switch (config_typed->algorithm) {
+    case osrm::EngineConfig::Algorithm::CH:
+      *out_algorithm = ALGORITHM_CH;
+      break;
+    case osrm::EngineConfig::Algorithm::MLD:
+      *out_algorithm = ALGORITHM_MLD;
+      break;
+    default:
+      osrmc_set_error(error, "InvalidAlgorithm", "Unknown algorithm type in config");
+      return;
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+static const char*
+osrmc_feature_dataset_name(osrm::storage::FeatureDataset dataset) {
+  switch (dataset) {
+    case osrm::storage::FeatureDataset::ROUTE_STEPS:
+      return "route_steps";
+    case osrm::storage::FeatureDataset::ROUTE_GEOMETRY:
+      return "route_geometry";
+    default:
+      return "unknown";
+  }
+}
+
+void
+osrmc_config_disable_feature_dataset(osrmc_config_t config, const char* dataset_name, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  if (!dataset_name) {
+    osrmc_set_error(error, "InvalidDataset", "Dataset name must not be null");
+    return;
+  }
+
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  // Convert to lowercase and check dataset name
+  std::string lower_name = dataset_name;
+  std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), [](unsigned char ch) {
+    return static_cast<char>(std::tolower(ch));
+  });
+  std::optional<osrm::storage::FeatureDataset> dataset;
+  if (lower_name == "route_steps") {
+    dataset = osrm::storage::FeatureDataset::ROUTE_STEPS;
+  } else if (lower_name == "route_geometry") {
+    dataset = osrm::storage::FeatureDataset::ROUTE_GEOMETRY;
+  }
+  if (!dataset) {
+    osrmc_set_error(error, "InvalidDataset", "Unknown dataset");
+    return;
+  }
+
+  const auto exists =
+    std::find(config_typed->disable_feature_dataset.begin(), config_typed->disable_feature_dataset.end(), *dataset) !=
+    config_typed->disable_feature_dataset.end();
+  if (!exists) {
+    config_typed->disable_feature_dataset.push_back(*dataset);
+    const auto base_path = config_typed->storage_config.base_path;
+    if (!base_path.empty()) {
+      config_typed->storage_config = osrm::StorageConfig(base_path, config_typed->disable_feature_dataset);
+    } else {
+      config_typed->storage_config = osrm::StorageConfig(config_typed->disable_feature_dataset);
+    }
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_disabled_feature_dataset_count(osrmc_config_t config, size_t* out_count, osrmc_error_t* error) try {
+  if (!out_count) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_count = config_typed->disable_feature_dataset.size();
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_disabled_feature_dataset_at(osrmc_config_t config,
+                                             size_t index,
+                                             const char** out_dataset_name,
+                                             osrmc_error_t* error) try {
+  if (!out_dataset_name) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  if (index >= config_typed->disable_feature_dataset.size()) {
+    osrmc_set_error(error, "InvalidIndex", "Dataset index out of range");
+    return;
+  }
+  *out_dataset_name = osrmc_feature_dataset_name(config_typed->disable_feature_dataset[index]);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_verbosity(osrmc_config_t config, const char* verbosity, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->verbosity = verbosity ? verbosity : "";
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_verbosity(osrmc_config_t config, const char** out_verbosity, osrmc_error_t* error) try {
+  if (!out_verbosity) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_verbosity = config_typed->verbosity.c_str();
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_dataset_name(osrmc_config_t config, const char* dataset_name, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->dataset_name = dataset_name ? dataset_name : "";
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_dataset_name(osrmc_config_t config, const char** out_dataset_name, osrmc_error_t* error) try {
+  if (!out_dataset_name) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  *out_dataset_name = config_typed->dataset_name.c_str();
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_clear_disabled_feature_datasets(osrmc_config_t config, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* config_typed = &reinterpret_cast<osrmc_config*>(config)->engine_config;
+  config_typed->disable_feature_dataset.clear();
+  const auto base_path = config_typed->storage_config.base_path;
+  if (!base_path.empty()) {
+    config_typed->storage_config = osrm::StorageConfig(base_path, config_typed->disable_feature_dataset);
+  } else {
+    config_typed->storage_config = osrm::StorageConfig(config_typed->disable_feature_dataset);
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_set_worker_threads(osrmc_config_t config, unsigned worker_threads, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  reinterpret_cast<osrmc_config*>(config)->worker_threads = worker_threads;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_config_get_worker_threads(osrmc_config_t config, unsigned* out_worker_threads, osrmc_error_t* error) try {
+  if (!out_worker_threads) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  *out_worker_threads = reinterpret_cast<osrmc_config*>(config)->worker_threads;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+/* OSRM */
+
+// Warms the OS page cache over the dataset files matching the config's base
+// path. The engine's own mappings are not reachable from the wrapper, but for
+// mmap-backed datasets priming the page cache on the same files has the same
+// effect: no page-fault storms on the first requests.
+static void
+osrmc_prefault_dataset_helper(const std::string& base_path, prefault_policy_t policy) {
+  if (policy == PREFAULT_NONE || base_path.empty()) {
+    return;
+  }
+  const std::filesystem::path base(base_path);
+  const auto stem = base.filename().string();
+  std::error_code list_error;
+  for (const auto& entry : std::filesystem::directory_iterator(base.parent_path(), list_error)) {
+    std::error_code entry_error;
+    if (!entry.is_regular_file(entry_error)) {
+      continue;
+    }
+    // Dataset files share the base file name as prefix (name.osrm.*)
+    if (entry.path().filename().string().rfind(stem, 0) != 0) {
+      continue;
+    }
+#ifndef _WIN32
+    const int fd = ::open(entry.path().c_str(), O_RDONLY);
+    if (fd < 0) {
+      continue;
+    }
+    if (policy == PREFAULT_READAHEAD) {
+      ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    } else {
+      std::vector<char> buffer(1 << 20);
+      while (::read(fd, buffer.data(), buffer.size()) > 0) {
+      }
+    }
+    ::close(fd);
+#else
+    // No posix_fadvise on Windows; reading the files warms the cache either way
+    std::ifstream file(entry.path(), std::ios::binary);
+    std::vector<char> buffer(1 << 20);
+    while (file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || file.gcount() > 0) {
+    }
+#endif
+  }
+}
+
+osrmc_osrm_t
+osrmc_osrm_construct(osrmc_config_t config, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return nullptr;
+  }
+  auto* config_typed = reinterpret_cast<osrmc_config*>(config);
+  auto out = std::make_unique<osrmc_osrm>();
+  osrmc_prefault_dataset_helper(config_typed->base_path, config_typed->prefault_policy);
+  out->engine = std::make_shared<osrm::OSRM>(config_typed->engine_config);
+  if (config_typed->worker_threads > 0) {
+    out->pool = std::make_unique<osrmc_worker_pool>(config_typed->worker_threads);
+  }
+
+  return reinterpret_cast<osrmc_osrm_t>(out.release());
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_osrm_destruct(osrmc_osrm_t osrm) {
+  if (osrm) {
+    delete reinterpret_cast<osrmc_osrm*>(osrm);
+  }
+}
+
+osrmc_osrm_t
+osrmc_osrm_construct_async(osrmc_config_t config, osrmc_error_t* error) try {
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return nullptr;
   }
+  auto* config_typed = reinterpret_cast<osrmc_config*>(config);
+  auto out = std::make_unique<osrmc_osrm>();
+  out->ready = false;
+  if (config_typed->worker_threads > 0) {
+    out->pool = std::make_unique<osrmc_worker_pool>(config_typed->worker_threads);
+  }
+
+  // Copy everything the build needs: the config may be destructed while the
+  // background construction is still running
+  auto* wrapper = out.get();
+  out->construction_thread = std::thread(
+    [wrapper, engine_config = config_typed->engine_config, base_path = config_typed->base_path,
+     policy = config_typed->prefault_policy]() mutable {
+      std::shared_ptr<osrm::OSRM> engine;
+      osrmc_error_t build_error = nullptr;
+      try {
+        osrmc_prefault_dataset_helper(base_path, policy);
+        engine = std::make_shared<osrm::OSRM>(engine_config);
+      } catch (const std::exception& e) {
+        osrmc_error_from_exception(e, &build_error);
+      }
+      {
+        std::lock_guard<std::mutex> lock(wrapper->engine_mutex);
+        wrapper->engine = std::move(engine);
+        wrapper->construction_error = build_error;
+        wrapper->ready = true;
+      }
+      wrapper->engine_condition.notify_all();
+    });
 
-  // Clear result
-  resp->result = osrm::json::Object();
+  return reinterpret_cast<osrmc_osrm_t>(out.release());
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
-// Service helpers
-template<typename ParamsHandle, typename ParamsType, typename ResponseHandle, typename MethodFunc>
-static ResponseHandle
-osrmc_service_helper(osrmc_osrm_t osrm,
-                     ParamsHandle params,
-                     MethodFunc method,
-                     const char* error_name,
-                     osrmc_error_t* error) try {
+int
+osrmc_osrm_is_ready(osrmc_osrm_t osrm, osrmc_error_t* error) try {
   if (!osrm) {
     osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
-    return nullptr;
+    return 0;
   }
-  if (!params) {
-    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
-    return nullptr;
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
+  std::lock_guard<std::mutex> lock(wrapper->engine_mutex);
+  if (!wrapper->ready) {
+    return 0;
   }
-  auto* osrm_typed = reinterpret_cast<osrm::OSRM*>(osrm);
-  auto* params_typed = reinterpret_cast<ParamsType*>(params);
+  if (wrapper->construction_error && error) {
+    *error = wrapper->construction_error;
+    wrapper->construction_error = nullptr;
+  }
+  return 1;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return 0;
+}
 
-  // Always use FlatBuffer format
-  osrm::engine::api::ResultT result = flatbuffers::FlatBufferBuilder();
-  const auto status = method(*osrm_typed, *params_typed, result);
+void
+osrmc_osrm_wait_ready(osrmc_osrm_t osrm, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return;
+  }
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
+  std::unique_lock<std::mutex> lock(wrapper->engine_mutex);
+  wrapper->engine_condition.wait(lock, [wrapper] { return wrapper->ready; });
+  if (wrapper->construction_error && error) {
+    *error = wrapper->construction_error;
+    wrapper->construction_error = nullptr;
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
 
-  if (status == osrm::Status::Ok) {
-    auto* out = new osrmc_response{std::move(result)};
-    return reinterpret_cast<ResponseHandle>(out);
+void
+osrmc_osrm_reload(osrmc_osrm_t osrm, osrmc_config_t config, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return;
   }
+  if (!config) {
+    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+    return;
+  }
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
+  auto* config_typed = reinterpret_cast<osrmc_config*>(config);
 
-  // Extract error from response, fallback to generic error
-  try {
-    if (error) {
-      // Errors are returned as JSON even when format is flatbuffers
-      // Try to extract error from result if it's JSON (for error responses)
-      if (std::holds_alternative<osrm::json::Object>(result)) {
-        auto& json = std::get<osrm::json::Object>(result);
-        auto code_it = json.values.find("code");
-        auto msg_it = json.values.find("message");
-        if (code_it != json.values.end() &&
-            std::holds_alternative<osrm::json::String>(code_it->second) &&
-            msg_it != json.values.end() &&
-            std::holds_alternative<osrm::json::String>(msg_it->second)) {
-          auto code = std::get<osrm::json::String>(code_it->second).value;
-          auto message = std::get<osrm::json::String>(msg_it->second).value;
-          if (code.empty()) {
-            code = "Unknown";
-          }
-          osrmc_set_error(error, code.c_str(), message.c_str());
-        } else {
-          osrmc_set_error(error, error_name, "Request failed");
-        }
-      } else {
-        osrmc_set_error(error, error_name, "Request failed");
-      }
-    }
-  } catch (...) {
-    osrmc_set_error(error, error_name, "Request failed");
+  // Construct first: only the reloading thread pays for the multi-second
+  // engine build, requests keep running against the old dataset meanwhile
+  auto engine = std::make_shared<osrm::OSRM>(config_typed->engine_config);
+
+  std::shared_ptr<osrm::OSRM> retired;
+  {
+    std::lock_guard<std::mutex> lock(wrapper->engine_mutex);
+    retired = std::move(wrapper->engine);
+    wrapper->engine = std::move(engine);
   }
-  return nullptr;
+  // Attached caches hold data derived from the old dataset
+  if (wrapper->hint_cache) {
+    wrapper->hint_cache->clear();
+  }
+  if (wrapper->result_cache) {
+    wrapper->result_cache->clear();
+  }
+  if (wrapper->tile_cache) {
+    wrapper->tile_cache->clear();
+  }
+  // retired drops here; the old engine is destroyed once the last in-flight
+  // request that snapshotted it completes
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
-  return nullptr;
 }
 
-/* Config */
-
-osrmc_config_t
-osrmc_config_construct(const char* base_path, osrmc_error_t* error) try {
-  auto* out = new osrm::EngineConfig;
+/* Registry */
 
-  if (base_path) {
-    out->storage_config = osrm::StorageConfig(std::filesystem::path(base_path));
-    out->use_shared_memory = false;
-  } else {
-    out->use_shared_memory = true;
+// Builds the engine for one registry entry, sharing the underlying
+// osrm::OSRM with any entry that already built the same dataset. Shared
+// memory identity is the dataset name; file-backed identity is the base path.
+static void
+osrmc_registry_build_entry_helper(osrmc_registry& registry, osrmc_registry_entry& entry) {
+  try {
+    auto wrapper = std::make_unique<osrmc_osrm>();
+    const auto dataset_key = entry.base_path.empty() ? "shm:" + entry.engine_config.dataset_name
+                                                     : "file:" + entry.base_path;
+    std::shared_ptr<osrm::OSRM> engine;
+    {
+      std::lock_guard<std::mutex> lock(registry.dedup_mutex);
+      const auto it = registry.dataset_engines.find(dataset_key);
+      if (it != registry.dataset_engines.end()) {
+        engine = it->second.lock();
+      }
+    }
+    if (!engine) {
+      osrmc_prefault_dataset_helper(entry.base_path, entry.prefault_policy);
+      engine = std::make_shared<osrm::OSRM>(entry.engine_config);
+      std::lock_guard<std::mutex> lock(registry.dedup_mutex);
+      registry.dataset_engines[dataset_key] = engine;
+    }
+    wrapper->engine = std::move(engine);
+    if (entry.worker_threads > 0) {
+      wrapper->pool = std::make_unique<osrmc_worker_pool>(entry.worker_threads);
+    }
+    entry.engine = std::move(wrapper);
+  } catch (const std::exception& e) {
+    entry.failure_message = e.what();
   }
+}
 
-  return reinterpret_cast<osrmc_config_t>(out);
+osrmc_registry_t
+osrmc_registry_construct(osrmc_error_t* error) try {
+  auto* out = new osrmc_registry;
+  return reinterpret_cast<osrmc_registry_t>(out);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
   return nullptr;
 }
 
 void
-osrmc_config_destruct(osrmc_config_t config) {
-  if (config) {
-    delete reinterpret_cast<osrm::EngineConfig*>(config);
+osrmc_registry_destruct(osrmc_registry_t registry) {
+  if (registry) {
+    delete reinterpret_cast<osrmc_registry*>(registry);
   }
 }
 
 void
-osrmc_config_set_max_locations_trip(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
+osrmc_registry_add(osrmc_registry_t registry, const char* name, osrmc_config_t config, osrmc_error_t* error) try {
+  if (!registry) {
+    osrmc_set_error(error, "InvalidArgument", "Registry must not be null");
+    return;
+  }
+  if (!name || name[0] == '\0') {
+    osrmc_set_error(error, "InvalidArgument", "Name must not be empty");
+    return;
+  }
   if (!config) {
     osrmc_set_error(error, "InvalidArgument", "Config must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_locations_trip = max_locations;
+  auto* registry_typed = reinterpret_cast<osrmc_registry*>(registry);
+  auto* config_typed = reinterpret_cast<osrmc_config*>(config);
+
+  auto entry = std::make_unique<osrmc_registry_entry>();
+  entry->engine_config = config_typed->engine_config;
+  entry->worker_threads = config_typed->worker_threads;
+  entry->base_path = config_typed->base_path;
+  entry->prefault_policy = config_typed->prefault_policy;
+
+  std::lock_guard<std::shared_mutex> lock(registry_typed->mutex);
+  if (!registry_typed->entries.emplace(name, std::move(entry)).second) {
+    osrmc_set_error(error, "InvalidArgument", "Name is already registered");
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_config_get_max_locations_trip(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
-  if (!out_max_locations) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
+osrmc_osrm_t
+osrmc_registry_get(osrmc_registry_t registry, const char* name, osrmc_error_t* error) try {
+  if (!registry) {
+    osrmc_set_error(error, "InvalidArgument", "Registry must not be null");
+    return nullptr;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  if (!name) {
+    osrmc_set_error(error, "InvalidArgument", "Name must not be null");
+    return nullptr;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_locations = config_typed->max_locations_trip;
+  auto* registry_typed = reinterpret_cast<osrmc_registry*>(registry);
+
+  osrmc_registry_entry* entry = nullptr;
+  {
+    std::shared_lock<std::shared_mutex> lock(registry_typed->mutex);
+    const auto it = registry_typed->entries.find(name);
+    if (it == registry_typed->entries.end()) {
+      osrmc_set_error(error, "NotFound", "No dataset registered under this name");
+      return nullptr;
+    }
+    // Entries are never removed, so the pointer stays valid past the lock
+    entry = it->second.get();
+  }
+
+  std::call_once(entry->built, [&] { osrmc_registry_build_entry_helper(*registry_typed, *entry); });
+  if (!entry->engine) {
+    osrmc_set_error(error, "RegistryError",
+                    entry->failure_message.empty() ? "Engine construction failed" : entry->failure_message.c_str());
+    return nullptr;
+  }
+  return reinterpret_cast<osrmc_osrm_t>(entry->engine.get());
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 void
-osrmc_config_set_max_locations_viaroute(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_registry_preload(osrmc_registry_t registry, osrmc_error_t* error) try {
+  if (!registry) {
+    osrmc_set_error(error, "InvalidArgument", "Registry must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_locations_viaroute = max_locations;
+  auto* registry_typed = reinterpret_cast<osrmc_registry*>(registry);
+
+  std::vector<osrmc_registry_entry*> pending;
+  {
+    std::shared_lock<std::shared_mutex> lock(registry_typed->mutex);
+    pending.reserve(registry_typed->entries.size());
+    for (auto& [entry_name, entry] : registry_typed->entries) {
+      (void)entry_name;
+      pending.push_back(entry.get());
+    }
+  }
+
+  std::vector<std::thread> builders;
+  builders.reserve(pending.size());
+  for (auto* entry : pending) {
+    builders.emplace_back(
+      [registry_typed, entry] { std::call_once(entry->built, [&] { osrmc_registry_build_entry_helper(*registry_typed, *entry); }); });
+  }
+  for (auto& builder : builders) {
+    builder.join();
+  }
+
+  for (auto* entry : pending) {
+    if (!entry->engine) {
+      osrmc_set_error(error, "RegistryError",
+                      entry->failure_message.empty() ? "Engine construction failed" : entry->failure_message.c_str());
+      return;
+    }
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
+/* Stats */
+
 void
-osrmc_config_get_max_locations_viaroute(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
-  if (!out_max_locations) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_stats_enable(osrmc_osrm_t osrm, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+  reinterpret_cast<osrmc_osrm*>(osrm)->stats.enabled.store(true, std::memory_order_relaxed);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_stats_disable(osrmc_osrm_t osrm, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_locations = config_typed->max_locations_viaroute;
+  reinterpret_cast<osrmc_osrm*>(osrm)->stats.enabled.store(false, std::memory_order_relaxed);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_set_max_locations_distance_table(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_stats_reset(osrmc_osrm_t osrm, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_locations_distance_table = max_locations;
+  reinterpret_cast<osrmc_osrm*>(osrm)->stats.reset();
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_get_max_locations_distance_table(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
-  if (!out_max_locations) {
+osrmc_stats_snapshot(osrmc_osrm_t osrm, osrmc_stats_t* out_stats, osrmc_error_t* error) try {
+  if (!out_stats) {
     osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_locations = config_typed->max_locations_distance_table;
+  const auto& stats = reinterpret_cast<osrmc_osrm*>(osrm)->stats;
+  for (size_t service = 0; service < OSRMC_SERVICE_COUNT; ++service) {
+    const auto& counters = stats.services[service];
+    auto& out = out_stats->services[service];
+    out.calls = counters.calls.load(std::memory_order_relaxed);
+    out.errors = counters.errors.load(std::memory_order_relaxed);
+    out.total_us = counters.total_us.load(std::memory_order_relaxed);
+    out.max_us = counters.max_us.load(std::memory_order_relaxed);
+    out.bytes_out = counters.bytes_out.load(std::memory_order_relaxed);
+    for (size_t bucket = 0; bucket < OSRMC_STATS_HISTOGRAM_BUCKETS; ++bucket) {
+      out.latency_histogram[bucket] = counters.latency_histogram[bucket].load(std::memory_order_relaxed);
+    }
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_config_set_max_locations_map_matching(osrmc_config_t config, int max_locations, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+/* Hint cache */
+
+osrmc_hint_cache_t
+osrmc_hint_cache_construct(size_t capacity, osrmc_error_t* error) try {
+  if (capacity == 0) {
+    osrmc_set_error(error, "InvalidArgument", "Capacity must not be zero");
+    return nullptr;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_locations_map_matching = max_locations;
+  auto* out = new osrmc_hint_cache(capacity);
+  return reinterpret_cast<osrmc_hint_cache_t>(out);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 void
-osrmc_config_get_max_locations_map_matching(osrmc_config_t config, int* out_max_locations, osrmc_error_t* error) try {
-  if (!out_max_locations) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_hint_cache_destruct(osrmc_hint_cache_t cache) {
+  if (cache) {
+    delete reinterpret_cast<osrmc_hint_cache*>(cache);
+  }
+}
+
+void
+osrmc_hint_cache_set_precision(osrmc_hint_cache_t cache, unsigned decimal_digits, osrmc_error_t* error) try {
+  if (!cache) {
+    osrmc_set_error(error, "InvalidArgument", "Cache must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+  if (decimal_digits < 1 || decimal_digits > 6) {
+    osrmc_set_error(error, "InvalidArgument", "Precision must be between 1 and 6 decimal digits");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_locations = config_typed->max_locations_map_matching;
+  reinterpret_cast<osrmc_hint_cache*>(cache)->set_precision(decimal_digits);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_set_max_radius_map_matching(osrmc_config_t config, double max_radius, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_hint_cache_stats(osrmc_hint_cache_t cache,
+                       size_t* out_entries,
+                       size_t* out_hits,
+                       size_t* out_misses,
+                       osrmc_error_t* error) try {
+  if (!cache) {
+    osrmc_set_error(error, "InvalidArgument", "Cache must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_radius_map_matching = max_radius;
+  auto* cache_typed = reinterpret_cast<osrmc_hint_cache*>(cache);
+  if (out_entries) {
+    *out_entries = cache_typed->entries();
+  }
+  if (out_hits) {
+    *out_hits = cache_typed->hits();
+  }
+  if (out_misses) {
+    *out_misses = cache_typed->misses();
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_get_max_radius_map_matching(osrmc_config_t config, double* out_max_radius, osrmc_error_t* error) try {
-  if (!out_max_radius) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_osrm_set_hint_cache(osrmc_osrm_t osrm, osrmc_hint_cache_t cache, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  reinterpret_cast<osrmc_osrm*>(osrm)->hint_cache = reinterpret_cast<osrmc_hint_cache*>(cache);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+/* Result cache */
+
+osrmc_result_cache_t
+osrmc_result_cache_construct(size_t max_bytes, int64_t ttl_ms, osrmc_error_t* error) try {
+  if (max_bytes == 0 || ttl_ms <= 0) {
+    osrmc_set_error(error, "InvalidArgument", "Byte budget and TTL must be positive");
+    return nullptr;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_radius = config_typed->max_radius_map_matching;
+  auto* out = new osrmc_result_cache(max_bytes, ttl_ms);
+  return reinterpret_cast<osrmc_result_cache_t>(out);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 void
-osrmc_config_set_max_results_nearest(osrmc_config_t config, int max_results, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_result_cache_destruct(osrmc_result_cache_t cache) {
+  if (cache) {
+    delete reinterpret_cast<osrmc_result_cache*>(cache);
+  }
+}
+
+void
+osrmc_result_cache_stats(osrmc_result_cache_t cache,
+                         size_t* out_entries,
+                         size_t* out_bytes,
+                         size_t* out_hits,
+                         size_t* out_misses,
+                         osrmc_error_t* error) try {
+  if (!cache) {
+    osrmc_set_error(error, "InvalidArgument", "Cache must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_results_nearest = max_results;
+  auto* cache_typed = reinterpret_cast<osrmc_result_cache*>(cache);
+  if (out_entries) {
+    *out_entries = cache_typed->entries();
+  }
+  if (out_bytes) {
+    *out_bytes = cache_typed->bytes();
+  }
+  if (out_hits) {
+    *out_hits = cache_typed->hits();
+  }
+  if (out_misses) {
+    *out_misses = cache_typed->misses();
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_get_max_results_nearest(osrmc_config_t config, int* out_max_results, osrmc_error_t* error) try {
-  if (!out_max_results) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_osrm_set_result_cache(osrmc_osrm_t osrm, osrmc_result_cache_t cache, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+  reinterpret_cast<osrmc_osrm*>(osrm)->result_cache = reinterpret_cast<osrmc_result_cache*>(cache);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+/* Tile cache */
+
+osrmc_tile_cache_t
+osrmc_tile_cache_construct(size_t max_bytes, osrmc_error_t* error) try {
+  if (max_bytes == 0) {
+    osrmc_set_error(error, "InvalidArgument", "Byte budget must not be zero");
+    return nullptr;
+  }
+  auto* out = new osrmc_tile_cache(max_bytes);
+  return reinterpret_cast<osrmc_tile_cache_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_tile_cache_destruct(osrmc_tile_cache_t cache) {
+  if (cache) {
+    delete reinterpret_cast<osrmc_tile_cache*>(cache);
+  }
+}
+
+void
+osrmc_tile_cache_clear(osrmc_tile_cache_t cache, osrmc_error_t* error) try {
+  if (!cache) {
+    osrmc_set_error(error, "InvalidArgument", "Cache must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_results = config_typed->max_results_nearest;
+  reinterpret_cast<osrmc_tile_cache*>(cache)->clear();
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_set_default_radius(osrmc_config_t config, double default_radius, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_tile_cache_stats(osrmc_tile_cache_t cache,
+                       size_t* out_entries,
+                       size_t* out_bytes,
+                       size_t* out_hits,
+                       size_t* out_misses,
+                       osrmc_error_t* error) try {
+  if (!cache) {
+    osrmc_set_error(error, "InvalidArgument", "Cache must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->default_radius = default_radius;
+  auto* cache_typed = reinterpret_cast<osrmc_tile_cache*>(cache);
+  if (out_entries) {
+    *out_entries = cache_typed->entries();
+  }
+  if (out_bytes) {
+    *out_bytes = cache_typed->bytes();
+  }
+  if (out_hits) {
+    *out_hits = cache_typed->hits();
+  }
+  if (out_misses) {
+    *out_misses = cache_typed->misses();
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_get_default_radius(osrmc_config_t config, double* out_default_radius, osrmc_error_t* error) try {
-  if (!out_default_radius) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
-  }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_osrm_set_tile_cache(osrmc_osrm_t osrm, osrmc_tile_cache_t cache, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_default_radius = config_typed->default_radius;
+  reinterpret_cast<osrmc_osrm*>(osrm)->tile_cache = reinterpret_cast<osrmc_tile_cache*>(cache);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_config_set_max_alternatives(osrmc_config_t config, int max_alternatives, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+/* Arena */
+
+osrmc_arena_t
+osrmc_arena_construct(size_t bytes, osrmc_error_t* error) try {
+  if (bytes == 0) {
+    osrmc_set_error(error, "InvalidArgument", "Arena size must be positive");
+    return nullptr;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->max_alternatives = max_alternatives;
+  auto* out = new osrmc_arena(bytes);
+  return reinterpret_cast<osrmc_arena_t>(out);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 void
-osrmc_config_get_max_alternatives(osrmc_config_t config, int* out_max_alternatives, osrmc_error_t* error) try {
-  if (!out_max_alternatives) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
-  }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+osrmc_arena_destruct(osrmc_arena_t arena) {
+  if (arena) {
+    auto* arena_typed = reinterpret_cast<osrmc_arena*>(arena);
+    if (osrmc_thread_arena() == arena_typed) {
+      osrmc_thread_arena() = nullptr;
+    }
+    delete arena_typed;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_max_alternatives = config_typed->max_alternatives;
+}
+
+void
+osrmc_arena_install(osrmc_arena_t arena, osrmc_error_t* error) try {
+  osrmc_thread_arena() = reinterpret_cast<osrmc_arena*>(arena);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_set_use_shared_memory(osrmc_config_t config, bool use_shared_memory, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_arena_reset(osrmc_arena_t arena, osrmc_error_t* error) try {
+  if (!arena) {
+    osrmc_set_error(error, "InvalidArgument", "Arena must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->use_shared_memory = use_shared_memory;
+  reinterpret_cast<osrmc_arena*>(arena)->reset();
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_get_use_shared_memory(osrmc_config_t config, bool* out_use_shared_memory, osrmc_error_t* error) try {
-  if (!out_use_shared_memory) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_arena_usage(osrmc_arena_t arena, size_t* out_used, size_t* out_overflow, osrmc_error_t* error) try {
+  if (!arena) {
+    osrmc_set_error(error, "InvalidArgument", "Arena must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  auto* arena_typed = reinterpret_cast<osrmc_arena*>(arena);
+  if (out_used) {
+    *out_used = arena_typed->used();
+  }
+  if (out_overflow) {
+    *out_overflow = arena_typed->overflow();
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_use_shared_memory = config_typed->use_shared_memory;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_config_set_memory_file(osrmc_config_t config, const char* memory_file, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
-  }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  if (memory_file) {
-    config_typed->memory_file = std::filesystem::path(memory_file);
-  } else {
-    config_typed->memory_file.clear();
+/* Request */
+
+int
+osrmc_request_poll(osrmc_request_t request, osrmc_error_t* error) try {
+  if (!request) {
+    osrmc_set_error(error, "InvalidArgument", "Request must not be null");
+    return 0;
   }
+  auto* request_typed = reinterpret_cast<osrmc_request*>(request);
+  std::lock_guard<std::mutex> lock(request_typed->mutex);
+  return request_typed->complete ? 1 : 0;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return 0;
 }
 
 void
-osrmc_config_get_memory_file(osrmc_config_t config, const char** out_memory_file, osrmc_error_t* error) try {
-  if (!out_memory_file) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_request_wait(osrmc_request_t request, osrmc_error_t* error) try {
+  if (!request) {
+    osrmc_set_error(error, "InvalidArgument", "Request must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
-  }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  // On Windows, path::c_str() returns wchar_t*, so we need to convert to string first
-  thread_local static std::string memory_file_str;
-  memory_file_str = config_typed->memory_file.string();
-  *out_memory_file = memory_file_str.c_str();
+  auto* request_typed = reinterpret_cast<osrmc_request*>(request);
+  std::unique_lock<std::mutex> lock(request_typed->mutex);
+  request_typed->condition.wait(lock, [request_typed] { return request_typed->complete; });
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_set_use_mmap(osrmc_config_t config, bool use_mmap, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_request_cancel(osrmc_request_t request, osrmc_error_t* error) try {
+  if (!request) {
+    osrmc_set_error(error, "InvalidArgument", "Request must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->use_mmap = use_mmap;
+  auto* request_typed = reinterpret_cast<osrmc_request*>(request);
+  request_typed->cancelled.store(true, std::memory_order_release);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_config_get_use_mmap(osrmc_config_t config, bool* out_use_mmap, osrmc_error_t* error) try {
-  if (!out_use_mmap) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
+void*
+osrmc_request_response(osrmc_request_t request, osrmc_error_t* error) try {
+  if (!request) {
+    osrmc_set_error(error, "InvalidArgument", "Request must not be null");
+    return nullptr;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  auto* request_typed = reinterpret_cast<osrmc_request*>(request);
+  std::lock_guard<std::mutex> lock(request_typed->mutex);
+  if (!request_typed->complete) {
+    osrmc_set_error(error, "NotReady", "Request has not completed yet");
+    return nullptr;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_use_mmap = config_typed->use_mmap;
+  if (request_typed->request_error) {
+    if (error) {
+      *error = request_typed->request_error;
+      request_typed->request_error = nullptr;
+    }
+    return nullptr;
+  }
+  auto* response = request_typed->response;
+  request_typed->response = nullptr;
+  return response;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 void
-osrmc_config_set_algorithm(osrmc_config_t config, algorithm_t algorithm, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+osrmc_request_destruct(osrmc_request_t request) {
+  if (request) {
+    osrmc_request_release(reinterpret_cast<osrmc_request*>(request));
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
+}
 
-  switch (algorithm) {
-    case ALGORITHM_CH:
-      config_typed->algorithm = osrm::EngineConfig::Algorithm::CH;
-      break;
-    case ALGORITHM_MLD:
-      config_typed->algorithm = osrm::EngineConfig::Algorithm::MLD;
-      break;
+/* Queue */
+
+// Runs one queued request through the service's synchronous entry point
+static void*
+osrmc_queue_dispatch_helper(osrmc_osrm_t osrm, osrmc_service_t service, void* params, osrmc_error_t* error) {
+  switch (service) {
+    case OSRMC_SERVICE_ROUTE:
+      return osrmc_route(osrm, reinterpret_cast<osrmc_route_params_t>(params), error);
+    case OSRMC_SERVICE_TABLE:
+      return osrmc_table(osrm, reinterpret_cast<osrmc_table_params_t>(params), error);
+    case OSRMC_SERVICE_MATCH:
+      return osrmc_match(osrm, reinterpret_cast<osrmc_match_params_t>(params), error);
+    case OSRMC_SERVICE_TRIP:
+      return osrmc_trip(osrm, reinterpret_cast<osrmc_trip_params_t>(params), error);
+    case OSRMC_SERVICE_NEAREST:
+      return osrmc_nearest(osrm, reinterpret_cast<osrmc_nearest_params_t>(params), error);
+    case OSRMC_SERVICE_TILE:
+      return osrmc_tile(osrm, reinterpret_cast<osrmc_tile_params_t>(params), error);
     default:
-      osrmc_set_error(error, "InvalidAlgorithm", "Unknown algorithm type");
-      return;
+      osrmc_set_error(error, "InvalidArgument", "Unknown service kind");
+      return nullptr;
   }
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_config_get_algorithm(osrmc_config_t config, algorithm_t* out_algorithm, osrmc_error_t* error) try {
-  if (!out_algorithm) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
-  }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+// Releases an undrained response with the destructor matching its service
+static void
+osrmc_queue_destroy_response_helper(osrmc_service_t service, void* response) {
+  if (!response) {
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  switch (config_typed->algorithm) {
-    case osrm::EngineConfig::Algorithm::CH:
-      *out_algorithm = ALGORITHM_CH;
+  switch (service) {
+    case OSRMC_SERVICE_ROUTE:
+      osrmc_route_response_destruct(reinterpret_cast<osrmc_route_response_t>(response));
       break;
-    case osrm::EngineConfig::Algorithm::MLD:
-      *out_algorithm = ALGORITHM_MLD;
+    case OSRMC_SERVICE_TABLE:
+      osrmc_table_response_destruct(reinterpret_cast<osrmc_table_response_t>(response));
+      break;
+    case OSRMC_SERVICE_MATCH:
+      osrmc_match_response_destruct(reinterpret_cast<osrmc_match_response_t>(response));
+      break;
+    case OSRMC_SERVICE_TRIP:
+      osrmc_trip_response_destruct(reinterpret_cast<osrmc_trip_response_t>(response));
+      break;
+    case OSRMC_SERVICE_NEAREST:
+      osrmc_nearest_response_destruct(reinterpret_cast<osrmc_nearest_response_t>(response));
+      break;
+    case OSRMC_SERVICE_TILE:
+      osrmc_tile_response_destruct(reinterpret_cast<osrmc_tile_response_t>(response));
       break;
     default:
-      osrmc_set_error(error, "InvalidAlgorithm", "Unknown algorithm type in config");
-      return;
+      break;
   }
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
 }
 
-static const char*
-osrmc_feature_dataset_name(osrm::storage::FeatureDataset dataset) {
-  switch (dataset) {
-    case osrm::storage::FeatureDataset::ROUTE_STEPS:
-      return "route_steps";
-    case osrm::storage::FeatureDataset::ROUTE_GEOMETRY:
-      return "route_geometry";
-    default:
-      return "unknown";
+// Queue behind osrmc_queue_t: jobs feed the queue's own worker threads, and
+// completions pile up for batched draining. Mutex-and-condvar like
+// osrmc_worker_pool: submissions come from one binding thread and drains are
+// batched, so queue lock contention is noise next to the requests themselves.
+struct osrmc_queue final {
+  struct job final {
+    uint64_t ticket;
+    osrmc_service_t service;
+    void* params;
+  };
+  struct completion final {
+    uint64_t ticket;
+    osrmc_service_t service;
+    void* response;
+    osrmc_error_t error;
+  };
+
+  osrmc_osrm_t osrm;
+  std::mutex mutex;
+  std::condition_variable work_condition;
+  std::condition_variable done_condition;
+  std::deque<job> jobs;
+  std::deque<completion> completed;
+  size_t in_flight = 0;
+  uint64_t next_ticket = 1;
+  bool stopping = false;
+  std::vector<std::thread> workers;
+
+  osrmc_queue(osrmc_osrm_t osrm_handle, unsigned n_workers) : osrm(osrm_handle) {
+    workers.reserve(n_workers);
+    for (unsigned i = 0; i < n_workers; ++i) {
+      workers.emplace_back([this] { run(); });
+    }
   }
-}
 
-void
-osrmc_config_disable_feature_dataset(osrmc_config_t config, const char* dataset_name, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
-  }
-  if (!dataset_name) {
-    osrmc_set_error(error, "InvalidDataset", "Dataset name must not be null");
-    return;
+  void run() {
+    for (;;) {
+      job current;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        work_condition.wait(lock, [this] { return stopping || !jobs.empty(); });
+        if (stopping) {
+          return;
+        }
+        current = jobs.front();
+        jobs.pop_front();
+      }
+      osrmc_error_t job_error = nullptr;
+      void* response = osrmc_queue_dispatch_helper(osrm, current.service, current.params, &job_error);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        completed.push_back({current.ticket, current.service, response, job_error});
+        --in_flight;
+      }
+      done_condition.notify_all();
+    }
   }
 
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  // Convert to lowercase and check dataset name
-  std::string lower_name = dataset_name;
-  std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), [](unsigned char ch) {
-    return static_cast<char>(std::tolower(ch));
-  });
-  std::optional<osrm::storage::FeatureDataset> dataset;
-  if (lower_name == "route_steps") {
-    dataset = osrm::storage::FeatureDataset::ROUTE_STEPS;
-  } else if (lower_name == "route_geometry") {
-    dataset = osrm::storage::FeatureDataset::ROUTE_GEOMETRY;
-  }
-  if (!dataset) {
-    osrmc_set_error(error, "InvalidDataset", "Unknown dataset");
-    return;
+  ~osrmc_queue() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+      // Pending jobs are dropped; they never count as completed
+      in_flight -= jobs.size();
+      jobs.clear();
+    }
+    work_condition.notify_all();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    for (auto& leftover : completed) {
+      osrmc_queue_destroy_response_helper(leftover.service, leftover.response);
+      if (leftover.error) {
+        osrmc_error_destruct(leftover.error);
+      }
+    }
   }
+};
 
-  const auto exists =
-    std::find(config_typed->disable_feature_dataset.begin(), config_typed->disable_feature_dataset.end(), *dataset) !=
-    config_typed->disable_feature_dataset.end();
-  if (!exists) {
-    config_typed->disable_feature_dataset.push_back(*dataset);
-    const auto base_path = config_typed->storage_config.base_path;
-    if (!base_path.empty()) {
-      config_typed->storage_config = osrm::StorageConfig(base_path, config_typed->disable_feature_dataset);
-    } else {
-      config_typed->storage_config = osrm::StorageConfig(config_typed->disable_feature_dataset);
-    }
+// Shared drain loop for the blocking and non-blocking pop variants
+static size_t
+osrmc_queue_drain_helper(osrmc_queue& queue, uint64_t* tickets_out, void** responses_out, osrmc_error_t* errors_out, size_t max) {
+  size_t drained = 0;
+  while (drained < max && !queue.completed.empty()) {
+    auto& completion = queue.completed.front();
+    tickets_out[drained] = completion.ticket;
+    responses_out[drained] = completion.response;
+    errors_out[drained] = completion.error;
+    queue.completed.pop_front();
+    ++drained;
   }
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
+  return drained;
 }
 
-void
-osrmc_config_get_disabled_feature_dataset_count(osrmc_config_t config, size_t* out_count, osrmc_error_t* error) try {
-  if (!out_count) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
+osrmc_queue_t
+osrmc_queue_construct(osrmc_osrm_t osrm, unsigned n_workers, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return nullptr;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  if (n_workers == 0) {
+    osrmc_set_error(error, "InvalidArgument", "Worker count must be positive");
+    return nullptr;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_count = config_typed->disable_feature_dataset.size();
+  auto* out = new osrmc_queue(osrm, n_workers);
+  return reinterpret_cast<osrmc_queue_t>(out);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 void
-osrmc_config_get_disabled_feature_dataset_at(osrmc_config_t config,
-                                             size_t index,
-                                             const char** out_dataset_name,
-                                             osrmc_error_t* error) try {
-  if (!out_dataset_name) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
+osrmc_queue_destruct(osrmc_queue_t queue) {
+  if (queue) {
+    delete reinterpret_cast<osrmc_queue*>(queue);
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+}
+
+uint64_t
+osrmc_queue_push(osrmc_queue_t queue, osrmc_service_t service, void* params, osrmc_error_t* error) try {
+  if (!queue) {
+    osrmc_set_error(error, "InvalidArgument", "Queue must not be null");
+    return 0;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  if (index >= config_typed->disable_feature_dataset.size()) {
-    osrmc_set_error(error, "InvalidIndex", "Dataset index out of range");
-    return;
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return 0;
   }
-  *out_dataset_name = osrmc_feature_dataset_name(config_typed->disable_feature_dataset[index]);
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
-}
+  if (service < OSRMC_SERVICE_ROUTE || service >= OSRMC_SERVICE_COUNT) {
+    osrmc_set_error(error, "InvalidArgument", "Unknown service kind");
+    return 0;
+  }
+  auto* queue_typed = reinterpret_cast<osrmc_queue*>(queue);
 
-void
-osrmc_config_set_verbosity(osrmc_config_t config, const char* verbosity, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  uint64_t ticket = 0;
+  {
+    std::lock_guard<std::mutex> lock(queue_typed->mutex);
+    ticket = queue_typed->next_ticket++;
+    queue_typed->jobs.push_back({ticket, service, params});
+    ++queue_typed->in_flight;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->verbosity = verbosity ? verbosity : "";
+  queue_typed->work_condition.notify_one();
+  return ticket;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return 0;
 }
 
-void
-osrmc_config_get_verbosity(osrmc_config_t config, const char** out_verbosity, osrmc_error_t* error) try {
-  if (!out_verbosity) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
+size_t
+osrmc_queue_pop_ready(osrmc_queue_t queue,
+                      uint64_t* tickets_out,
+                      void** responses_out,
+                      osrmc_error_t* errors_out,
+                      size_t max,
+                      osrmc_error_t* error) try {
+  if (!queue) {
+    osrmc_set_error(error, "InvalidArgument", "Queue must not be null");
+    return 0;
+  }
+  if (max > 0 && (!tickets_out || !responses_out || !errors_out)) {
+    osrmc_set_error(error, "InvalidArgument", "Output arrays must not be null");
+    return 0;
+  }
+  auto* queue_typed = reinterpret_cast<osrmc_queue*>(queue);
+
+  std::lock_guard<std::mutex> lock(queue_typed->mutex);
+  return osrmc_queue_drain_helper(*queue_typed, tickets_out, responses_out, errors_out, max);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return 0;
+}
+
+size_t
+osrmc_queue_pop_wait(osrmc_queue_t queue,
+                     uint64_t* tickets_out,
+                     void** responses_out,
+                     osrmc_error_t* errors_out,
+                     size_t max,
+                     osrmc_error_t* error) try {
+  if (!queue) {
+    osrmc_set_error(error, "InvalidArgument", "Queue must not be null");
+    return 0;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return;
+  if (max > 0 && (!tickets_out || !responses_out || !errors_out)) {
+    osrmc_set_error(error, "InvalidArgument", "Output arrays must not be null");
+    return 0;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_verbosity = config_typed->verbosity.c_str();
+  auto* queue_typed = reinterpret_cast<osrmc_queue*>(queue);
+
+  std::unique_lock<std::mutex> lock(queue_typed->mutex);
+  queue_typed->done_condition.wait(
+    lock, [queue_typed] { return !queue_typed->completed.empty() || queue_typed->in_flight == 0; });
+  return osrmc_queue_drain_helper(*queue_typed, tickets_out, responses_out, errors_out, max);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
+  return 0;
 }
 
+/* Base */
+
 void
-osrmc_config_set_dataset_name(osrmc_config_t config, const char* dataset_name, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_params_add_coordinate(osrmc_params_t params, double longitude, double latitude, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->dataset_name = dataset_name ? dataset_name : "";
+  auto* params_typed = reinterpret_cast<osrm::engine::api::BaseParameters*>(params);
+
+  params_typed->coordinates.emplace_back(osrm::util::FloatLongitude{longitude}, osrm::util::FloatLatitude{latitude});
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_get_dataset_name(osrmc_config_t config, const char** out_dataset_name, osrmc_error_t* error) try {
-  if (!out_dataset_name) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_params_add_coordinates_bulk(osrmc_params_t params,
+                                  const double* longitudes,
+                                  const double* latitudes,
+                                  size_t count,
+                                  osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
     return;
   }
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+  if (count > 0 && (!longitudes || !latitudes)) {
+    osrmc_set_error(error, "InvalidArgument", "Coordinate arrays must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  *out_dataset_name = config_typed->dataset_name.c_str();
+  auto* params_typed = reinterpret_cast<osrm::engine::api::BaseParameters*>(params);
+
+  params_typed->coordinates.reserve(params_typed->coordinates.size() + count);
+  for (size_t i = 0; i < count; ++i) {
+    params_typed->coordinates.emplace_back(osrm::util::FloatLongitude{longitudes[i]},
+                                           osrm::util::FloatLatitude{latitudes[i]});
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
 void
-osrmc_config_clear_disabled_feature_datasets(osrmc_config_t config, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
+osrmc_params_add_coordinates_fixed(osrmc_params_t params,
+                                   const int32_t* longitudes,
+                                   const int32_t* latitudes,
+                                   size_t count,
+                                   osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
     return;
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  config_typed->disable_feature_dataset.clear();
-  const auto base_path = config_typed->storage_config.base_path;
-  if (!base_path.empty()) {
-    config_typed->storage_config = osrm::StorageConfig(base_path, config_typed->disable_feature_dataset);
-  } else {
-    config_typed->storage_config = osrm::StorageConfig(config_typed->disable_feature_dataset);
+  if (count > 0 && (!longitudes || !latitudes)) {
+    osrmc_set_error(error, "InvalidArgument", "Coordinate arrays must not be null");
+    return;
   }
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
-}
-
-/* OSRM */
-
-osrmc_osrm_t
-osrmc_osrm_construct(osrmc_config_t config, osrmc_error_t* error) try {
-  if (!config) {
-    osrmc_set_error(error, "InvalidArgument", "Config must not be null");
-    return nullptr;
+  // Reject the whole batch before touching the params, so a failed call
+  // leaves them unchanged
+  for (size_t i = 0; i < count; ++i) {
+    if (longitudes[i] < -180000000 || longitudes[i] > 180000000) {
+      osrmc_set_error(error, "InvalidArgument", "Fixed longitude out of range");
+      return;
+    }
+    if (latitudes[i] < -90000000 || latitudes[i] > 90000000) {
+      osrmc_set_error(error, "InvalidArgument", "Fixed latitude out of range");
+      return;
+    }
   }
-  auto* config_typed = reinterpret_cast<osrm::EngineConfig*>(config);
-  auto* out = new osrm::OSRM(*config_typed);
+  auto* params_typed = reinterpret_cast<osrm::engine::api::BaseParameters*>(params);
 
-  return reinterpret_cast<osrmc_osrm_t>(out);
+  params_typed->coordinates.reserve(params_typed->coordinates.size() + count);
+  for (size_t i = 0; i < count; ++i) {
+    params_typed->coordinates.emplace_back(osrm::util::FixedLongitude{longitudes[i]},
+                                           osrm::util::FixedLatitude{latitudes[i]});
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
-  return nullptr;
-}
-
-void
-osrmc_osrm_destruct(osrmc_osrm_t osrm) {
-  if (osrm) {
-    delete reinterpret_cast<osrm::OSRM*>(osrm);
-  }
 }
 
-/* Base */
-
 void
-osrmc_params_add_coordinate(osrmc_params_t params, double longitude, double latitude, osrmc_error_t* error) try {
+osrmc_params_freeze(osrmc_params_t params, osrmc_error_t* error) try {
   if (!params) {
     osrmc_set_error(error, "InvalidArgument", "Params must not be null");
     return;
   }
-  auto* params_typed = reinterpret_cast<osrm::engine::api::BaseParameters*>(params);
-
-  params_typed->coordinates.emplace_back(osrm::util::FloatLongitude{longitude}, osrm::util::FloatLatitude{latitude});
+  std::unique_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  osrmc_params_metadata_map()[params].frozen = true;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
@@ -958,6 +3509,36 @@ osrmc_params_get_hint(osrmc_params_t params,
   osrmc_error_from_exception(e, error);
 }
 
+void
+osrmc_params_get_hint_buf(osrmc_params_t params,
+                          size_t coordinate_index,
+                          char* buf,
+                          size_t capacity,
+                          size_t* out_needed,
+                          osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::engine::api::BaseParameters*>(params);
+  if (coordinate_index >= params_typed->coordinates.size()) {
+    osrmc_set_error(error, "InvalidCoordinateIndex", "Coordinate index out of bounds");
+    return;
+  }
+  if (coordinate_index >= params_typed->hints.size() || !params_typed->hints[coordinate_index]) {
+    if (out_needed) {
+      *out_needed = 0;
+    }
+    if (buf && capacity > 0) {
+      buf[0] = '\0';
+    }
+    return;
+  }
+  osrmc_copy_string_helper(params_typed->hints[coordinate_index]->ToBase64(), buf, capacity, out_needed, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_params_set_radius(osrmc_params_t params, size_t coordinate_index, double radius, osrmc_error_t* error) try {
   if (!params) {
@@ -983,6 +3564,38 @@ osrmc_params_set_radius(osrmc_params_t params, size_t coordinate_index, double r
   osrmc_error_from_exception(e, error);
 }
 
+void
+osrmc_params_set_radiuses_bulk(osrmc_params_t params,
+                               const double* radiuses,
+                               size_t count,
+                               osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  if (count > 0 && !radiuses) {
+    osrmc_set_error(error, "InvalidArgument", "Radius array must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::engine::api::BaseParameters*>(params);
+  if (count != params_typed->coordinates.size()) {
+    osrmc_set_error(error, "InvalidArgument", "Radius count must equal coordinate count");
+    return;
+  }
+
+  params_typed->radiuses.clear();
+  params_typed->radiuses.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    if (radiuses[i] >= 0.0) {
+      params_typed->radiuses.emplace_back(radiuses[i]);
+    } else {
+      params_typed->radiuses.emplace_back(std::nullopt);
+    }
+  }
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_params_get_radius(osrmc_params_t params,
                         size_t coordinate_index,
@@ -1315,6 +3928,64 @@ osrmc_params_get_snapping(osrmc_params_t params, snapping_t* out_snapping, osrmc
   osrmc_error_from_exception(e, error);
 }
 
+void
+osrmc_params_set_timeout_ms(osrmc_params_t params, int64_t timeout_ms, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  if (timeout_ms < 0) {
+    osrmc_set_error(error, "InvalidArgument", "Timeout must not be negative");
+    return;
+  }
+  std::unique_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  osrmc_params_metadata_map()[params].timeout_ms = timeout_ms;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_params_get_timeout_ms(osrmc_params_t params, int64_t* out_timeout_ms, osrmc_error_t* error) try {
+  if (!out_timeout_ms) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  *out_timeout_ms = osrmc_params_metadata_get(params).timeout_ms;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_params_set_response_size_hint(osrmc_params_t params, size_t bytes, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  std::unique_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  osrmc_params_metadata_map()[params].response_size_hint = bytes;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_params_get_response_size_hint(osrmc_params_t params, size_t* out_bytes, osrmc_error_t* error) try {
+  if (!out_bytes) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  *out_bytes = osrmc_params_metadata_get(params).response_size_hint;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 
 /* Nearest */
 
@@ -1332,10 +4003,39 @@ osrmc_nearest_params_construct(osrmc_error_t* error) try {
 void
 osrmc_nearest_params_destruct(osrmc_nearest_params_t params) {
   if (params) {
+    osrmc_params_metadata_erase(params);
     delete reinterpret_cast<osrm::NearestParameters*>(params);
   }
 }
 
+osrmc_nearest_params_t
+osrmc_nearest_params_clone(osrmc_nearest_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* out = new osrm::NearestParameters(*reinterpret_cast<osrm::NearestParameters*>(params));
+  osrmc_params_metadata_clone_helper(params, out);
+  return reinterpret_cast<osrmc_nearest_params_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_nearest_params_reset(osrmc_nearest_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::NearestParameters*>(params);
+  const osrm::NearestParameters defaults;
+  osrmc_reset_base_params_helper(*params_typed);
+  params_typed->number_of_results = defaults.number_of_results;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_nearest_params_set_number_of_results(osrmc_nearest_params_t params, unsigned n, osrmc_error_t* error) try {
   if (!params) {
@@ -1370,6 +4070,7 @@ osrmc_nearest(osrmc_osrm_t osrm, osrmc_nearest_params_t params, osrmc_error_t* e
     osrm,
     params,
     [](osrm::OSRM& o, osrm::NearestParameters& p, osrm::engine::api::ResultT& r) { return o.Nearest(p, r); },
+    OSRMC_SERVICE_NEAREST,
     "NearestError",
     error);
 } catch (const std::exception& e) {
@@ -1382,38 +4083,213 @@ osrmc_nearest_response_destruct(osrmc_nearest_response_t response) {
   if (response) {
     delete reinterpret_cast<osrmc_response*>(response);
   }
-}
-
-void
-osrmc_nearest_response_transfer_flatbuffer(osrmc_nearest_response_t response,
-                                           uint8_t** data,
-                                           size_t* size,
-                                           void (**deleter)(void*),
-                                           osrmc_error_t* error) try {
-  if (!response) {
-    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
-    if (data)
-      *data = nullptr;
-    if (size)
-      *size = 0;
-    if (deleter)
-      *deleter = nullptr;
+}
+
+void
+osrmc_nearest_response_transfer_flatbuffer(osrmc_nearest_response_t response,
+                                           uint8_t** data,
+                                           size_t* size,
+                                           void (**deleter)(void*),
+                                           osrmc_error_t* error) try {
+  if (!response) {
+    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
+    if (data)
+      *data = nullptr;
+    if (size)
+      *size = 0;
+    if (deleter)
+      *deleter = nullptr;
+    return;
+  }
+  if (!data || !size || !deleter) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
+    return;
+  }
+  auto* resp = reinterpret_cast<osrmc_response*>(response);
+  osrmc_transfer_flatbuffer_helper(resp, data, size, deleter, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  if (data)
+    *data = nullptr;
+  if (size)
+    *size = 0;
+  if (deleter)
+    *deleter = nullptr;
+}
+
+void
+osrmc_nearest_response_data(osrmc_nearest_response_t response,
+                            const uint8_t** data,
+                            size_t* size,
+                            osrmc_error_t* error) try {
+  osrmc_response_data_helper(reinterpret_cast<osrmc_response*>(response), data, size, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_nearest_response_write_fd(osrmc_nearest_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error) try {
+  osrmc_response_write_fd_helper(reinterpret_cast<osrmc_response*>(response), fd, length_prefix, out_written, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_nearest_batch(osrmc_osrm_t osrm,
+                    const osrmc_nearest_params_t* params,
+                    size_t count,
+                    osrmc_nearest_response_t* responses_out,
+                    osrmc_error_t* errors_out,
+                    osrmc_error_t* error) try {
+  osrmc_batch_helper<osrmc_nearest_params_t, osrm::NearestParameters, osrmc_nearest_response_t>(
+    osrm,
+    params,
+    count,
+    responses_out,
+    errors_out,
+    [](osrm::OSRM& o, osrm::NearestParameters& p, osrm::engine::api::ResultT& r) { return o.Nearest(p, r); },
+    OSRMC_SERVICE_NEAREST,
+    "NearestError",
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+// Snaps one point with a reused params object and a pooled builder; returns 0
+// on success, 1 when the point could not be snapped
+static int
+osrmc_nearest_snap_one_helper(osrm::OSRM& engine,
+                              osrm::NearestParameters& params,
+                              double longitude,
+                              double latitude,
+                              double* out_longitude,
+                              double* out_latitude,
+                              double* out_distance) {
+  params.coordinates.clear();
+  params.coordinates.emplace_back(osrm::util::FloatLongitude{longitude}, osrm::util::FloatLatitude{latitude});
+
+  osrm::engine::api::ResultT result = osrmc_builder_acquire();
+  const auto status = engine.Nearest(params, result);
+
+  int snap_status = 1;
+  if (status == osrm::Status::Ok && std::holds_alternative<flatbuffers::FlatBufferBuilder>(result)) {
+    auto& builder = std::get<flatbuffers::FlatBufferBuilder>(result);
+    const auto* fb_result = osrm::engine::api::fbresult::GetFBResult(builder.GetBufferPointer());
+    const auto* waypoints = fb_result && !fb_result->error() ? fb_result->waypoints() : nullptr;
+    if (waypoints && waypoints->size() > 0) {
+      const auto* waypoint = waypoints->Get(0);
+      const auto* location = waypoint->location();
+      if (location) {
+        *out_longitude = location->longitude();
+        *out_latitude = location->latitude();
+        *out_distance = waypoint->distance();
+        snap_status = 0;
+      }
+    }
+  }
+  if (auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result)) {
+    osrmc_builder_release(std::move(*builder));
+  }
+  return snap_status;
+}
+
+void
+osrmc_nearest_snap_batch(osrmc_osrm_t osrm,
+                         const double* longitudes,
+                         const double* latitudes,
+                         size_t count,
+                         double* out_longitudes,
+                         double* out_latitudes,
+                         double* out_distances,
+                         int* out_status,
+                         osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return;
+  }
+  if (count == 0) {
+    return;
+  }
+  if (!longitudes || !latitudes || !out_longitudes || !out_latitudes || !out_distances || !out_status) {
+    osrmc_set_error(error, "InvalidArgument", "Batch arrays must not be null");
+    return;
+  }
+  const auto engine_ref = reinterpret_cast<osrmc_osrm*>(osrm)->engine_snapshot();
+  if (!engine_ref) {
+    osrmc_set_error(error, "NotReady", "Engine is still loading");
     return;
   }
-  if (!data || !size || !deleter) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
+  auto& engine = *engine_ref;
+  osrmc_stats_scope stats;
+  stats.arm(reinterpret_cast<osrmc_osrm*>(osrm)->stats, OSRMC_SERVICE_NEAREST);
+
+  // Each drain task owns one params object, reused across all its points
+  auto run_range = [&](std::atomic<size_t>& next_index) {
+    osrm::NearestParameters params;
+    params.format = osrm::engine::api::BaseParameters::OutputFormatType::FLATBUFFERS;
+    params.number_of_results = 1;
+    for (size_t i = next_index.fetch_add(1); i < count; i = next_index.fetch_add(1)) {
+      out_status[i] = osrmc_nearest_snap_one_helper(engine, params, longitudes[i], latitudes[i], &out_longitudes[i],
+                                                    &out_latitudes[i], &out_distances[i]);
+    }
+  };
+
+  std::atomic<size_t> next_index{0};
+  auto* pool = reinterpret_cast<osrmc_osrm*>(osrm)->pool.get();
+  if (pool && count > 1) {
+    const auto task_count = std::min<size_t>(pool->size(), count);
+    std::mutex done_mutex;
+    std::condition_variable done_condition;
+    size_t remaining = task_count;
+
+    for (size_t t = 0; t < task_count; ++t) {
+      pool->submit([&] {
+        run_range(next_index);
+        {
+          std::lock_guard<std::mutex> lock(done_mutex);
+          --remaining;
+        }
+        done_condition.notify_one();
+      });
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_condition.wait(lock, [&] { return remaining == 0; });
+    stats.failed = false;
     return;
   }
-  auto* resp = reinterpret_cast<osrmc_response*>(response);
-  osrmc_transfer_flatbuffer_helper(resp, data, size, deleter, error);
+
+  run_range(next_index);
+  stats.failed = false;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
-  if (data)
-    *data = nullptr;
-  if (size)
-    *size = 0;
-  if (deleter)
-    *deleter = nullptr;
+}
+
+osrmc_request_t
+osrmc_nearest_submit(osrmc_osrm_t osrm,
+                     osrmc_nearest_params_t params,
+                     osrmc_completion_t callback,
+                     void* user_data,
+                     osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  return osrmc_submit_helper(
+    osrm,
+    params,
+    [osrm, params](osrmc_error_t* task_error) -> void* { return osrmc_nearest(osrm, params, task_error); },
+    [](void* response) { osrmc_nearest_response_destruct(reinterpret_cast<osrmc_nearest_response_t>(response)); },
+    callback,
+    user_data,
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
 }
 
 /* Route */
@@ -1432,10 +4308,36 @@ osrmc_route_params_construct(osrmc_error_t* error) try {
 void
 osrmc_route_params_destruct(osrmc_route_params_t params) {
   if (params) {
+    osrmc_params_metadata_erase(params);
     delete reinterpret_cast<osrm::RouteParameters*>(params);
   }
 }
 
+osrmc_route_params_t
+osrmc_route_params_clone(osrmc_route_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* out = new osrm::RouteParameters(*reinterpret_cast<osrm::RouteParameters*>(params));
+  osrmc_params_metadata_clone_helper(params, out);
+  return reinterpret_cast<osrmc_route_params_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_route_params_reset(osrmc_route_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  osrmc_reset_route_params_helper(*reinterpret_cast<osrm::RouteParameters*>(params));
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_route_params_set_steps(osrmc_route_params_t params, int on, osrmc_error_t* error) try {
   if (!params) {
@@ -1779,6 +4681,7 @@ osrmc_route(osrmc_osrm_t osrm, osrmc_route_params_t params, osrmc_error_t* error
     osrm,
     params,
     [](osrm::OSRM& o, osrm::RouteParameters& p, osrm::engine::api::ResultT& r) { return o.Route(p, r); },
+    OSRMC_SERVICE_ROUTE,
     "RouteError",
     error);
 } catch (const std::exception& e) {
@@ -1825,6 +4728,71 @@ osrmc_route_response_transfer_flatbuffer(osrmc_route_response_t response,
     *deleter = nullptr;
 }
 
+void
+osrmc_route_response_data(osrmc_route_response_t response,
+                          const uint8_t** data,
+                          size_t* size,
+                          osrmc_error_t* error) try {
+  osrmc_response_data_helper(reinterpret_cast<osrmc_response*>(response), data, size, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_route_response_write_fd(osrmc_route_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error) try {
+  osrmc_response_write_fd_helper(reinterpret_cast<osrmc_response*>(response), fd, length_prefix, out_written, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_route_batch(osrmc_osrm_t osrm,
+                  const osrmc_route_params_t* params,
+                  size_t count,
+                  osrmc_route_response_t* responses_out,
+                  osrmc_error_t* errors_out,
+                  osrmc_error_t* error) try {
+  osrmc_batch_helper<osrmc_route_params_t, osrm::RouteParameters, osrmc_route_response_t>(
+    osrm,
+    params,
+    count,
+    responses_out,
+    errors_out,
+    [](osrm::OSRM& o, osrm::RouteParameters& p, osrm::engine::api::ResultT& r) { return o.Route(p, r); },
+    OSRMC_SERVICE_ROUTE,
+    "RouteError",
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+osrmc_request_t
+osrmc_route_submit(osrmc_osrm_t osrm,
+                   osrmc_route_params_t params,
+                   osrmc_completion_t callback,
+                   void* user_data,
+                   osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  return osrmc_submit_helper(
+    osrm,
+    params,
+    [osrm, params](osrmc_error_t* task_error) -> void* { return osrmc_route(osrm, params, task_error); },
+    [](void* response) { osrmc_route_response_destruct(reinterpret_cast<osrmc_route_response_t>(response)); },
+    callback,
+    user_data,
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
 /* Table */
 
 osrmc_table_params_t
@@ -1841,10 +4809,44 @@ osrmc_table_params_construct(osrmc_error_t* error) try {
 void
 osrmc_table_params_destruct(osrmc_table_params_t params) {
   if (params) {
+    osrmc_params_metadata_erase(params);
     delete reinterpret_cast<osrm::TableParameters*>(params);
   }
 }
 
+osrmc_table_params_t
+osrmc_table_params_clone(osrmc_table_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* out = new osrm::TableParameters(*reinterpret_cast<osrm::TableParameters*>(params));
+  osrmc_params_metadata_clone_helper(params, out);
+  return reinterpret_cast<osrmc_table_params_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_table_params_reset(osrmc_table_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::TableParameters*>(params);
+  const osrm::TableParameters defaults;
+  osrmc_reset_base_params_helper(*params_typed);
+  params_typed->sources.clear();
+  params_typed->destinations.clear();
+  params_typed->annotations = defaults.annotations;
+  params_typed->fallback_speed = defaults.fallback_speed;
+  params_typed->fallback_coordinate_type = defaults.fallback_coordinate_type;
+  params_typed->scale_factor = defaults.scale_factor;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_table_params_add_source(osrmc_table_params_t params, size_t index, osrmc_error_t* error) try {
   if (!params) {
@@ -2107,71 +5109,466 @@ osrmc_table_params_set_scale_factor(osrmc_table_params_t params, double scale_fa
 }
 
 void
-osrmc_table_params_get_scale_factor(osrmc_table_params_t params, double* out_scale_factor, osrmc_error_t* error) try {
-  if (!out_scale_factor) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
-    return;
-  }
-  if (!params) {
-    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
-    return;
-  }
-  auto* params_typed = reinterpret_cast<osrm::TableParameters*>(params);
-  *out_scale_factor = params_typed->scale_factor;
+osrmc_table_params_get_scale_factor(osrmc_table_params_t params, double* out_scale_factor, osrmc_error_t* error) try {
+  if (!out_scale_factor) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::TableParameters*>(params);
+  *out_scale_factor = params_typed->scale_factor;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+osrmc_table_response_t
+osrmc_table(osrmc_osrm_t osrm, osrmc_table_params_t params, osrmc_error_t* error) try {
+  return osrmc_service_helper<osrmc_table_params_t, osrm::TableParameters, osrmc_table_response_t>(
+    osrm,
+    params,
+    [](osrm::OSRM& o, osrm::TableParameters& p, osrm::engine::api::ResultT& r) { return o.Table(p, r); },
+    OSRMC_SERVICE_TABLE,
+    "TableError",
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_table_response_destruct(osrmc_table_response_t response) {
+  if (response) {
+    delete reinterpret_cast<osrmc_response*>(response);
+  }
+}
+
+void
+osrmc_table_response_transfer_flatbuffer(osrmc_table_response_t response,
+                                         uint8_t** data,
+                                         size_t* size,
+                                         void (**deleter)(void*),
+                                         osrmc_error_t* error) try {
+  if (!response) {
+    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
+    if (data)
+      *data = nullptr;
+    if (size)
+      *size = 0;
+    if (deleter)
+      *deleter = nullptr;
+    return;
+  }
+  if (!data || !size || !deleter) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
+    return;
+  }
+  auto* resp = reinterpret_cast<osrmc_response*>(response);
+  osrmc_transfer_flatbuffer_helper(resp, data, size, deleter, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  if (data)
+    *data = nullptr;
+  if (size)
+    *size = 0;
+  if (deleter)
+    *deleter = nullptr;
+}
+
+void
+osrmc_table_response_data(osrmc_table_response_t response,
+                          const uint8_t** data,
+                          size_t* size,
+                          osrmc_error_t* error) try {
+  osrmc_response_data_helper(reinterpret_cast<osrmc_response*>(response), data, size, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_table_response_write_fd(osrmc_table_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error) try {
+  osrmc_response_write_fd_helper(reinterpret_cast<osrmc_response*>(response), fd, length_prefix, out_written, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+// Uniform view over a table response: either the generated FlatBuffer
+// TableResult or a matrix assembled natively by osrmc_table_parallel().
+// Reading through the view keeps matrix access in native code instead of
+// interpreted FlatBuffer traversal in the binding.
+struct osrmc_table_view final {
+  size_t rows = 0;
+  size_t cols = 0;
+  const float* durations = nullptr;
+  const float* distances = nullptr;
+};
+
+static bool
+osrmc_table_view_helper(osrmc_response* resp, osrmc_table_view* view, osrmc_error_t* error) {
+  if (!resp) {
+    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
+    return false;
+  }
+  if (resp->assembled) {
+    view->rows = resp->assembled->rows;
+    view->cols = resp->assembled->cols;
+    view->durations = resp->assembled->durations.empty() ? nullptr : resp->assembled->durations.data();
+    view->distances = resp->assembled->distances.empty() ? nullptr : resp->assembled->distances.data();
+    return true;
+  }
+  if (!std::holds_alternative<flatbuffers::FlatBufferBuilder>(resp->result)) {
+    osrmc_set_error(error, "InvalidFormat", "Response is not in FlatBuffer format");
+    return false;
+  }
+  auto& builder = std::get<flatbuffers::FlatBufferBuilder>(resp->result);
+  const auto* fb_result = osrm::engine::api::fbresult::GetFBResult(builder.GetBufferPointer());
+  const auto* table = fb_result ? fb_result->table() : nullptr;
+  if (!table) {
+    osrmc_set_error(error, "InvalidFormat", "Response has no table result");
+    return false;
+  }
+  view->rows = table->rows();
+  view->cols = table->cols();
+  view->durations = table->durations() ? table->durations()->data() : nullptr;
+  view->distances = table->distances() ? table->distances()->data() : nullptr;
+  return true;
+}
+
+// Copies a row-major matrix into a caller buffer; shared between the duration
+// and distance exports
+static void
+osrmc_table_copy_matrix_helper(osrmc_table_response_t response,
+                               const float* osrmc_table_view::*matrix,
+                               const char* matrix_name,
+                               float* out,
+                               size_t capacity,
+                               size_t* out_count,
+                               osrmc_error_t* error) {
+  if (out_count) {
+    *out_count = 0;
+  }
+  osrmc_table_view view;
+  if (!osrmc_table_view_helper(reinterpret_cast<osrmc_response*>(response), &view, error)) {
+    return;
+  }
+  const float* values = view.*matrix;
+  if (!values) {
+    const std::string message = std::string("Response has no ") + matrix_name + " annotations";
+    osrmc_set_error(error, "InvalidFormat", message.c_str());
+    return;
+  }
+  if (!out) {
+    osrmc_set_error(error, "InvalidArgument", "Output buffer must not be null");
+    return;
+  }
+  const size_t count = view.rows * view.cols;
+  if (capacity < count) {
+    osrmc_set_error(error, "BufferTooSmall", "Output buffer capacity is less than rows * cols");
+    return;
+  }
+  std::memcpy(out, values, count * sizeof(float));
+  if (out_count) {
+    *out_count = count;
+  }
+}
+
+// Reads one matrix cell with bounds checking; shared between the duration and
+// distance spot reads
+static void
+osrmc_table_get_cell_helper(osrmc_table_response_t response,
+                            const float* osrmc_table_view::*matrix,
+                            const char* matrix_name,
+                            size_t row,
+                            size_t col,
+                            float* out_value,
+                            osrmc_error_t* error) {
+  if (!out_value) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  osrmc_table_view view;
+  if (!osrmc_table_view_helper(reinterpret_cast<osrmc_response*>(response), &view, error)) {
+    return;
+  }
+  if (row >= view.rows || col >= view.cols) {
+    osrmc_set_error(error, "InvalidIndex", "Matrix index out of bounds");
+    return;
+  }
+  const float* values = view.*matrix;
+  if (!values) {
+    const std::string message = std::string("Response has no ") + matrix_name + " annotations";
+    osrmc_set_error(error, "InvalidFormat", message.c_str());
+    return;
+  }
+  *out_value = values[row * view.cols + col];
+}
+
+void
+osrmc_table_response_get_dimensions(osrmc_table_response_t response,
+                                    size_t* out_rows,
+                                    size_t* out_cols,
+                                    osrmc_error_t* error) try {
+  if (!out_rows || !out_cols) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
+    return;
+  }
+  osrmc_table_view view;
+  if (!osrmc_table_view_helper(reinterpret_cast<osrmc_response*>(response), &view, error)) {
+    return;
+  }
+  *out_rows = view.rows;
+  *out_cols = view.cols;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_table_response_get_duration(osrmc_table_response_t response,
+                                  size_t row,
+                                  size_t col,
+                                  float* out_duration,
+                                  osrmc_error_t* error) try {
+  osrmc_table_get_cell_helper(response, &osrmc_table_view::durations, "duration", row, col, out_duration, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_table_response_get_distance(osrmc_table_response_t response,
+                                  size_t row,
+                                  size_t col,
+                                  float* out_distance,
+                                  osrmc_error_t* error) try {
+  osrmc_table_get_cell_helper(response, &osrmc_table_view::distances, "distance", row, col, out_distance, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_table_response_copy_durations(osrmc_table_response_t response,
+                                    float* out,
+                                    size_t capacity,
+                                    size_t* out_count,
+                                    osrmc_error_t* error) try {
+  osrmc_table_copy_matrix_helper(response, &osrmc_table_view::durations, "duration", out, capacity, out_count, error);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
 }
 
-osrmc_table_response_t
-osrmc_table(osrmc_osrm_t osrm, osrmc_table_params_t params, osrmc_error_t* error) try {
-  return osrmc_service_helper<osrmc_table_params_t, osrm::TableParameters, osrmc_table_response_t>(
+void
+osrmc_table_response_copy_distances(osrmc_table_response_t response,
+                                    float* out,
+                                    size_t capacity,
+                                    size_t* out_count,
+                                    osrmc_error_t* error) try {
+  osrmc_table_copy_matrix_helper(response, &osrmc_table_view::distances, "distance", out, capacity, out_count, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_table_batch(osrmc_osrm_t osrm,
+                  const osrmc_table_params_t* params,
+                  size_t count,
+                  osrmc_table_response_t* responses_out,
+                  osrmc_error_t* errors_out,
+                  osrmc_error_t* error) try {
+  osrmc_batch_helper<osrmc_table_params_t, osrm::TableParameters, osrmc_table_response_t>(
     osrm,
     params,
+    count,
+    responses_out,
+    errors_out,
     [](osrm::OSRM& o, osrm::TableParameters& p, osrm::engine::api::ResultT& r) { return o.Table(p, r); },
+    OSRMC_SERVICE_TABLE,
     "TableError",
     error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+osrmc_request_t
+osrmc_table_submit(osrmc_osrm_t osrm,
+                   osrmc_table_params_t params,
+                   osrmc_completion_t callback,
+                   void* user_data,
+                   osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  return osrmc_submit_helper(
+    osrm,
+    params,
+    [osrm, params](osrmc_error_t* task_error) -> void* { return osrmc_table(osrm, params, task_error); },
+    [](void* response) { osrmc_table_response_destruct(reinterpret_cast<osrmc_table_response_t>(response)); },
+    callback,
+    user_data,
+    error);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
   return nullptr;
 }
 
-void
-osrmc_table_response_destruct(osrmc_table_response_t response) {
-  if (response) {
-    delete reinterpret_cast<osrmc_response*>(response);
+// Runs one contiguous block of source rows as its own Table call and copies
+// the resulting rows into the assembled matrices. Rows are disjoint between
+// chunks, so the writes need no locking.
+static void
+osrmc_table_parallel_chunk_helper(osrm::OSRM& engine,
+                                  const osrm::TableParameters& params,
+                                  const std::vector<size_t>& sources,
+                                  size_t row_offset,
+                                  size_t row_count,
+                                  size_t cols,
+                                  osrmc_assembled_table& assembled,
+                                  osrmc_error_t* chunk_error) {
+  osrm::TableParameters chunk_params = params;
+  chunk_params.sources.assign(sources.begin() + static_cast<ptrdiff_t>(row_offset),
+                              sources.begin() + static_cast<ptrdiff_t>(row_offset + row_count));
+
+  osrm::engine::api::ResultT result = osrmc_builder_acquire();
+  const auto status = engine.Table(chunk_params, result);
+  auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result);
+
+  if (status != osrm::Status::Ok || !builder) {
+    osrmc_set_error(chunk_error, "TableError", "Parallel table chunk failed");
+    return;
+  }
+  const auto* fb_result = osrm::engine::api::fbresult::GetFBResult(builder->GetBufferPointer());
+  const auto* table = fb_result && !fb_result->error() ? fb_result->table() : nullptr;
+  if (!table || table->cols() != cols || table->rows() != row_count) {
+    osrmc_set_error(chunk_error, "TableError", "Parallel table chunk returned unexpected dimensions");
+    osrmc_builder_release(std::move(*builder));
+    return;
+  }
+  if (!assembled.durations.empty()) {
+    const auto* durations = table->durations();
+    if (!durations) {
+      osrmc_set_error(chunk_error, "TableError", "Parallel table chunk is missing durations");
+      osrmc_builder_release(std::move(*builder));
+      return;
+    }
+    std::memcpy(assembled.durations.data() + row_offset * cols, durations->data(), row_count * cols * sizeof(float));
   }
+  if (!assembled.distances.empty()) {
+    const auto* distances = table->distances();
+    if (!distances) {
+      osrmc_set_error(chunk_error, "TableError", "Parallel table chunk is missing distances");
+      osrmc_builder_release(std::move(*builder));
+      return;
+    }
+    std::memcpy(assembled.distances.data() + row_offset * cols, distances->data(), row_count * cols * sizeof(float));
+  }
+  osrmc_builder_release(std::move(*builder));
 }
 
-void
-osrmc_table_response_transfer_flatbuffer(osrmc_table_response_t response,
-                                         uint8_t** data,
-                                         size_t* size,
-                                         void (**deleter)(void*),
-                                         osrmc_error_t* error) try {
-  if (!response) {
-    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
-    if (data)
-      *data = nullptr;
-    if (size)
-      *size = 0;
-    if (deleter)
-      *deleter = nullptr;
-    return;
+osrmc_table_response_t
+osrmc_table_parallel(osrmc_osrm_t osrm, osrmc_table_params_t params, osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return nullptr;
   }
-  if (!data || !size || !deleter) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
-    return;
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
   }
-  auto* resp = reinterpret_cast<osrmc_response*>(response);
-  osrmc_transfer_flatbuffer_helper(resp, data, size, deleter, error);
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
+  auto* params_typed = reinterpret_cast<osrm::TableParameters*>(params);
+
+  // Empty sources/destinations mean "all coordinates"; materialize the source
+  // list so it can be split into row blocks
+  std::vector<size_t> sources = params_typed->sources;
+  if (sources.empty()) {
+    sources.resize(params_typed->coordinates.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+      sources[i] = i;
+    }
+  }
+  const size_t rows = sources.size();
+  const size_t cols =
+    params_typed->destinations.empty() ? params_typed->coordinates.size() : params_typed->destinations.size();
+
+  auto* pool = wrapper->pool.get();
+  const size_t chunk_count = pool ? std::min<size_t>(pool->size(), rows) : 1;
+  if (chunk_count < 2 || cols == 0) {
+    return osrmc_table(osrm, params, error);
+  }
+
+  const auto annotations = static_cast<int>(params_typed->annotations);
+  const bool want_durations = (annotations & static_cast<int>(osrm::TableParameters::AnnotationsType::Duration)) != 0;
+  const bool want_distances = (annotations & static_cast<int>(osrm::TableParameters::AnnotationsType::Distance)) != 0;
+
+  auto assembled = std::make_unique<osrmc_assembled_table>();
+  assembled->rows = rows;
+  assembled->cols = cols;
+  if (want_durations) {
+    assembled->durations.resize(rows * cols);
+  }
+  if (want_distances) {
+    assembled->distances.resize(rows * cols);
+  }
+
+  const auto engine_ref = wrapper->engine_snapshot();
+  if (!engine_ref) {
+    osrmc_set_error(error, "NotReady", "Engine is still loading");
+    return nullptr;
+  }
+  auto& engine = *engine_ref;
+  osrmc_stats_scope stats;
+  stats.arm(wrapper->stats, OSRMC_SERVICE_TABLE);
+  std::vector<osrmc_error_t> chunk_errors(chunk_count, nullptr);
+  std::mutex done_mutex;
+  std::condition_variable done_condition;
+  size_t remaining = chunk_count;
+
+  const size_t base_rows = rows / chunk_count;
+  const size_t extra_rows = rows % chunk_count;
+  size_t row_offset = 0;
+  for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+    const size_t row_count = base_rows + (chunk < extra_rows ? 1 : 0);
+    pool->submit([&, chunk, row_offset, row_count] {
+      osrmc_table_parallel_chunk_helper(engine, *params_typed, sources, row_offset, row_count, cols, *assembled,
+                                        &chunk_errors[chunk]);
+      {
+        std::lock_guard<std::mutex> lock(done_mutex);
+        --remaining;
+      }
+      done_condition.notify_one();
+    });
+    row_offset += row_count;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_condition.wait(lock, [&] { return remaining == 0; });
+  }
+
+  for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+    if (chunk_errors[chunk]) {
+      if (error) {
+        *error = chunk_errors[chunk];
+        chunk_errors[chunk] = nullptr;
+      }
+      for (size_t rest = chunk; rest < chunk_count; ++rest) {
+        osrmc_error_destruct(chunk_errors[rest]);
+        chunk_errors[rest] = nullptr;
+      }
+      return nullptr;
+    }
+  }
+
+  stats.failed = false;
+  auto* out = new osrmc_response{osrm::json::Object(), {}, std::move(assembled), false};
+  return reinterpret_cast<osrmc_table_response_t>(out);
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
-  if (data)
-    *data = nullptr;
-  if (size)
-    *size = 0;
-  if (deleter)
-    *deleter = nullptr;
+  return nullptr;
 }
 
 /* Match */
@@ -2190,10 +5587,41 @@ osrmc_match_params_construct(osrmc_error_t* error) try {
 void
 osrmc_match_params_destruct(osrmc_match_params_t params) {
   if (params) {
+    osrmc_params_metadata_erase(params);
     delete reinterpret_cast<osrm::MatchParameters*>(params);
   }
 }
 
+osrmc_match_params_t
+osrmc_match_params_clone(osrmc_match_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* out = new osrm::MatchParameters(*reinterpret_cast<osrm::MatchParameters*>(params));
+  osrmc_params_metadata_clone_helper(params, out);
+  return reinterpret_cast<osrmc_match_params_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_match_params_reset(osrmc_match_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::MatchParameters*>(params);
+  const osrm::MatchParameters defaults;
+  osrmc_reset_route_params_helper(*params_typed);
+  params_typed->timestamps.clear();
+  params_typed->gaps = defaults.gaps;
+  params_typed->tidy = defaults.tidy;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_match_params_set_steps(osrmc_match_params_t params, int on, osrmc_error_t* error) try {
   if (!params) {
@@ -2543,6 +5971,27 @@ osrmc_match_params_add_timestamp(osrmc_match_params_t params, unsigned timestamp
   osrmc_error_from_exception(e, error);
 }
 
+void
+osrmc_match_params_add_timestamps_bulk(osrmc_match_params_t params,
+                                       const unsigned* timestamps,
+                                       size_t count,
+                                       osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  if (count > 0 && !timestamps) {
+    osrmc_set_error(error, "InvalidArgument", "Timestamp array must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::MatchParameters*>(params);
+
+  params_typed->timestamps.reserve(params_typed->timestamps.size() + count);
+  params_typed->timestamps.insert(params_typed->timestamps.end(), timestamps, timestamps + count);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_match_params_get_timestamp_count(osrmc_match_params_t params, size_t* out_count, osrmc_error_t* error) try {
   if (!out_count) {
@@ -2616,78 +6065,283 @@ osrmc_match_params_set_tidy(osrmc_match_params_t params, int on, osrmc_error_t*
     osrmc_set_error(error, "InvalidArgument", "Params must not be null");
     return;
   }
-  auto* params_typed = reinterpret_cast<osrm::MatchParameters*>(params);
-  params_typed->tidy = on != 0;
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
+  auto* params_typed = reinterpret_cast<osrm::MatchParameters*>(params);
+  params_typed->tidy = on != 0;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_match_params_get_tidy(osrmc_match_params_t params, int* out_on, osrmc_error_t* error) try {
+  if (!out_on) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::MatchParameters*>(params);
+  *out_on = params_typed->tidy ? 1 : 0;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+osrmc_match_response_t
+osrmc_match(osrmc_osrm_t osrm, osrmc_match_params_t params, osrmc_error_t* error) try {
+  return osrmc_service_helper<osrmc_match_params_t, osrm::MatchParameters, osrmc_match_response_t>(
+    osrm,
+    params,
+    [](osrm::OSRM& o, osrm::MatchParameters& p, osrm::engine::api::ResultT& r) { return o.Match(p, r); },
+    OSRMC_SERVICE_MATCH,
+    "MatchError",
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_match_response_destruct(osrmc_match_response_t response) {
+  if (response) {
+    delete reinterpret_cast<osrmc_response*>(response);
+  }
+}
+
+void
+osrmc_match_response_transfer_flatbuffer(osrmc_match_response_t response,
+                                         uint8_t** data,
+                                         size_t* size,
+                                         void (**deleter)(void*),
+                                         osrmc_error_t* error) try {
+  if (!response) {
+    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
+    if (data)
+      *data = nullptr;
+    if (size)
+      *size = 0;
+    if (deleter)
+      *deleter = nullptr;
+    return;
+  }
+  if (!data || !size || !deleter) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
+    return;
+  }
+  auto* resp = reinterpret_cast<osrmc_response*>(response);
+  osrmc_transfer_flatbuffer_helper(resp, data, size, deleter, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  if (data)
+    *data = nullptr;
+  if (size)
+    *size = 0;
+  if (deleter)
+    *deleter = nullptr;
+}
+
+void
+osrmc_match_response_data(osrmc_match_response_t response,
+                          const uint8_t** data,
+                          size_t* size,
+                          osrmc_error_t* error) try {
+  osrmc_response_data_helper(reinterpret_cast<osrmc_response*>(response), data, size, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_match_response_write_fd(osrmc_match_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error) try {
+  osrmc_response_write_fd_helper(reinterpret_cast<osrmc_response*>(response), fd, length_prefix, out_written, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+osrmc_request_t
+osrmc_match_submit(osrmc_osrm_t osrm,
+                   osrmc_match_params_t params,
+                   osrmc_completion_t callback,
+                   void* user_data,
+                   osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  return osrmc_submit_helper(
+    osrm,
+    params,
+    [osrm, params](osrmc_error_t* task_error) -> void* { return osrmc_match(osrm, params, task_error); },
+    [](void* response) { osrmc_match_response_destruct(reinterpret_cast<osrmc_match_response_t>(response)); },
+    callback,
+    user_data,
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+/* Match session */
+
+// Matches the first point_count buffered points as one window and queues the
+// response. Returns false with error set when the window failed to match.
+static bool
+osrmc_match_session_window_helper(osrmc_match_session* session, size_t point_count, osrmc_error_t* error) {
+  auto& params = session->window_params;
+  params.coordinates.assign(session->pending_coordinates.begin(),
+                            session->pending_coordinates.begin() + static_cast<ptrdiff_t>(point_count));
+  params.timestamps.clear();
+  if (session->use_timestamps) {
+    params.timestamps.assign(session->pending_timestamps.begin(),
+                             session->pending_timestamps.begin() + static_cast<ptrdiff_t>(point_count));
+  }
+  params.hints.clear();
+
+  auto response =
+    osrmc_match(session->osrm, reinterpret_cast<osrmc_match_params_t>(&session->window_params), error);
+  if (!response) {
+    return false;
+  }
+  session->responses.push_back(response);
+  return true;
+}
+
+// Drops the consumed front of the buffer, keeping the overlap points
+static void
+osrmc_match_session_advance_helper(osrmc_match_session* session, size_t point_count) {
+  const size_t drop = point_count > session->overlap ? point_count - session->overlap : point_count;
+  session->pending_coordinates.erase(session->pending_coordinates.begin(),
+                                     session->pending_coordinates.begin() + static_cast<ptrdiff_t>(drop));
+  if (session->use_timestamps) {
+    session->pending_timestamps.erase(session->pending_timestamps.begin(),
+                                      session->pending_timestamps.begin() + static_cast<ptrdiff_t>(drop));
+  }
+}
+
+osrmc_match_session_t
+osrmc_match_session_construct(osrmc_osrm_t osrm,
+                              osrmc_match_params_t params,
+                              size_t window_size,
+                              size_t overlap,
+                              osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return nullptr;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  if (window_size < 2 || overlap >= window_size) {
+    osrmc_set_error(error, "InvalidArgument", "Window size must be at least 2 and overlap smaller than the window");
+    return nullptr;
+  }
+  auto out = std::make_unique<osrmc_match_session>();
+  out->osrm = osrm;
+  out->window_params = *reinterpret_cast<osrm::MatchParameters*>(params);
+  out->window_size = window_size;
+  out->overlap = overlap;
+  out->pending_coordinates.reserve(window_size);
+  return reinterpret_cast<osrmc_match_session_t>(out.release());
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_match_session_destruct(osrmc_match_session_t session) {
+  if (session) {
+    auto* session_typed = reinterpret_cast<osrmc_match_session*>(session);
+    for (auto* response : session_typed->responses) {
+      osrmc_match_response_destruct(response);
+    }
+    delete session_typed;
+  }
 }
 
 void
-osrmc_match_params_get_tidy(osrmc_match_params_t params, int* out_on, osrmc_error_t* error) try {
-  if (!out_on) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+osrmc_match_session_feed(osrmc_match_session_t session,
+                         const double* longitudes,
+                         const double* latitudes,
+                         const unsigned* timestamps,
+                         size_t count,
+                         osrmc_error_t* error) try {
+  if (!session) {
+    osrmc_set_error(error, "InvalidArgument", "Session must not be null");
     return;
   }
-  if (!params) {
-    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+  if (count > 0 && (!longitudes || !latitudes)) {
+    osrmc_set_error(error, "InvalidArgument", "Coordinate arrays must not be null");
+    return;
+  }
+  auto* session_typed = reinterpret_cast<osrmc_match_session*>(session);
+  if (session_typed->pending_coordinates.empty() && session_typed->responses.empty()) {
+    session_typed->use_timestamps = timestamps != nullptr;
+  }
+  if (session_typed->use_timestamps && !timestamps && count > 0) {
+    osrmc_set_error(error, "InvalidArgument", "Session was fed timestamps before; they cannot be omitted now");
     return;
   }
-  auto* params_typed = reinterpret_cast<osrm::MatchParameters*>(params);
-  *out_on = params_typed->tidy ? 1 : 0;
-} catch (const std::exception& e) {
-  osrmc_error_from_exception(e, error);
-}
 
-osrmc_match_response_t
-osrmc_match(osrmc_osrm_t osrm, osrmc_match_params_t params, osrmc_error_t* error) try {
-  return osrmc_service_helper<osrmc_match_params_t, osrm::MatchParameters, osrmc_match_response_t>(
-    osrm,
-    params,
-    [](osrm::OSRM& o, osrm::MatchParameters& p, osrm::engine::api::ResultT& r) { return o.Match(p, r); },
-    "MatchError",
-    error);
+  session_typed->pending_coordinates.reserve(session_typed->pending_coordinates.size() + count);
+  for (size_t i = 0; i < count; ++i) {
+    session_typed->pending_coordinates.emplace_back(osrm::util::FloatLongitude{longitudes[i]},
+                                                    osrm::util::FloatLatitude{latitudes[i]});
+    if (session_typed->use_timestamps) {
+      session_typed->pending_timestamps.push_back(timestamps[i]);
+    }
+  }
+
+  while (session_typed->pending_coordinates.size() >= session_typed->window_size) {
+    const bool matched = osrmc_match_session_window_helper(session_typed, session_typed->window_size, error);
+    // Advance even when the window failed, otherwise a bad stretch of trace
+    // would stall the session forever
+    osrmc_match_session_advance_helper(session_typed, session_typed->window_size);
+    if (!matched) {
+      return;
+    }
+  }
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
-  return nullptr;
 }
 
 void
-osrmc_match_response_destruct(osrmc_match_response_t response) {
-  if (response) {
-    delete reinterpret_cast<osrmc_response*>(response);
+osrmc_match_session_flush(osrmc_match_session_t session, osrmc_error_t* error) try {
+  if (!session) {
+    osrmc_set_error(error, "InvalidArgument", "Session must not be null");
+    return;
   }
+  auto* session_typed = reinterpret_cast<osrmc_match_session*>(session);
+  const size_t point_count = session_typed->pending_coordinates.size();
+  if (point_count >= 2) {
+    osrmc_match_session_window_helper(session_typed, point_count, error);
+  }
+  // A trailing single point cannot be matched; drop it along with the rest
+  session_typed->pending_coordinates.clear();
+  session_typed->pending_timestamps.clear();
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
 }
 
-void
-osrmc_match_response_transfer_flatbuffer(osrmc_match_response_t response,
-                                         uint8_t** data,
-                                         size_t* size,
-                                         void (**deleter)(void*),
-                                         osrmc_error_t* error) try {
-  if (!response) {
-    osrmc_set_error(error, "InvalidArgument", "Response must not be null");
-    if (data)
-      *data = nullptr;
-    if (size)
-      *size = 0;
-    if (deleter)
-      *deleter = nullptr;
-    return;
+osrmc_match_response_t
+osrmc_match_session_pop_response(osrmc_match_session_t session, osrmc_error_t* error) try {
+  if (!session) {
+    osrmc_set_error(error, "InvalidArgument", "Session must not be null");
+    return nullptr;
   }
-  if (!data || !size || !deleter) {
-    osrmc_set_error(error, "InvalidArgument", "Output pointers must not be null");
-    return;
+  auto* session_typed = reinterpret_cast<osrmc_match_session*>(session);
+  if (session_typed->responses.empty()) {
+    return nullptr;
   }
-  auto* resp = reinterpret_cast<osrmc_response*>(response);
-  osrmc_transfer_flatbuffer_helper(resp, data, size, deleter, error);
+  auto* response = session_typed->responses.front();
+  session_typed->responses.pop_front();
+  return response;
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
-  if (data)
-    *data = nullptr;
-  if (size)
-    *size = 0;
-  if (deleter)
-    *deleter = nullptr;
+  return nullptr;
 }
 
 /* Trip */
@@ -2706,10 +6360,41 @@ osrmc_trip_params_construct(osrmc_error_t* error) try {
 void
 osrmc_trip_params_destruct(osrmc_trip_params_t params) {
   if (params) {
+    osrmc_params_metadata_erase(params);
     delete reinterpret_cast<osrm::TripParameters*>(params);
   }
 }
 
+osrmc_trip_params_t
+osrmc_trip_params_clone(osrmc_trip_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* out = new osrm::TripParameters(*reinterpret_cast<osrm::TripParameters*>(params));
+  osrmc_params_metadata_clone_helper(params, out);
+  return reinterpret_cast<osrmc_trip_params_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_trip_params_reset(osrmc_trip_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::TripParameters*>(params);
+  const osrm::TripParameters defaults;
+  osrmc_reset_route_params_helper(*params_typed);
+  params_typed->roundtrip = defaults.roundtrip;
+  params_typed->source = defaults.source;
+  params_typed->destination = defaults.destination;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_trip_params_set_roundtrip(osrmc_trip_params_t params, int on, osrmc_error_t* error) try {
   if (!params) {
@@ -3132,12 +6817,44 @@ osrmc_trip_params_get_waypoint(osrmc_trip_params_t params, size_t index, size_t*
   osrmc_error_from_exception(e, error);
 }
 
+void
+osrmc_trip_params_set_time_budget_ms(osrmc_trip_params_t params, int64_t budget_ms, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  if (budget_ms < 0) {
+    osrmc_set_error(error, "InvalidArgument", "Time budget must not be negative");
+    return;
+  }
+  std::unique_lock<std::shared_mutex> lock(osrmc_params_metadata_mutex);
+  osrmc_params_metadata_map()[params].time_budget_ms = budget_ms;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_trip_params_get_time_budget_ms(osrmc_trip_params_t params, int64_t* out_budget_ms, osrmc_error_t* error) try {
+  if (!out_budget_ms) {
+    osrmc_set_error(error, "InvalidArgument", "Output pointer must not be null");
+    return;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  *out_budget_ms = osrmc_params_metadata_get(params).time_budget_ms;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 osrmc_trip_response_t
 osrmc_trip(osrmc_osrm_t osrm, osrmc_trip_params_t params, osrmc_error_t* error) try {
   return osrmc_service_helper<osrmc_trip_params_t, osrm::TripParameters, osrmc_trip_response_t>(
     osrm,
     params,
     [](osrm::OSRM& o, osrm::TripParameters& p, osrm::engine::api::ResultT& r) { return o.Trip(p, r); },
+    OSRMC_SERVICE_TRIP,
     "TripError",
     error);
 } catch (const std::exception& e) {
@@ -3184,6 +6901,386 @@ osrmc_trip_response_transfer_flatbuffer(osrmc_trip_response_t response,
     *deleter = nullptr;
 }
 
+void
+osrmc_trip_response_data(osrmc_trip_response_t response,
+                         const uint8_t** data,
+                         size_t* size,
+                         osrmc_error_t* error) try {
+  osrmc_response_data_helper(reinterpret_cast<osrmc_response*>(response), data, size, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+void
+osrmc_trip_response_write_fd(osrmc_trip_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error) try {
+  osrmc_response_write_fd_helper(reinterpret_cast<osrmc_response*>(response), fd, length_prefix, out_written, error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
+// Recovers the visiting order from a Trip FlatBuffer payload: input waypoint
+// i carries its position in the computed tour. Returns false when the result
+// has no usable waypoints.
+static bool
+osrmc_trip_order_helper(const uint8_t* payload, std::vector<size_t>& order_out) {
+  const auto* fb_result = osrm::engine::api::fbresult::GetFBResult(payload);
+  const auto* waypoints = fb_result && !fb_result->error() ? fb_result->waypoints() : nullptr;
+  if (!waypoints || waypoints->size() == 0) {
+    return false;
+  }
+  order_out.assign(waypoints->size(), 0);
+  for (uint32_t input_index = 0; input_index < waypoints->size(); ++input_index) {
+    const auto position = waypoints->Get(input_index)->waypoint_index();
+    if (position >= order_out.size()) {
+      return false;
+    }
+    order_out[position] = input_index;
+  }
+  return true;
+}
+
+static bool
+osrmc_trip_order_helper(const flatbuffers::FlatBufferBuilder& builder, std::vector<size_t>& order_out) {
+  return osrmc_trip_order_helper(builder.GetBufferPointer(), order_out);
+}
+
+// FlatBuffer payload of a trip response, wherever it lives: the shared cache
+// entry for cache hits, the builder otherwise. Null for JSON results.
+static const uint8_t*
+osrmc_trip_payload_helper(const osrmc_response& response) {
+  if (response.cached) {
+    return response.cached->data();
+  }
+  if (const auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&response.result)) {
+    return builder->GetBufferPointer();
+  }
+  return nullptr;
+}
+
+// Duration of the first route in a FlatBuffer result; infinity when the
+// result carries none, so comparisons always prefer a real tour
+static double
+osrmc_first_route_duration_helper(const uint8_t* payload) {
+  const auto* fb_result = osrm::engine::api::fbresult::GetFBResult(payload);
+  const auto* routes = fb_result && !fb_result->error() ? fb_result->routes() : nullptr;
+  if (!routes || routes->size() == 0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return routes->Get(0)->duration();
+}
+
+static double
+osrmc_first_route_duration_helper(const flatbuffers::FlatBufferBuilder& builder) {
+  return osrmc_first_route_duration_helper(builder.GetBufferPointer());
+}
+
+// Carries the caller's snapping options into a derived query: BaseParameters
+// scalars are copied as-is and the per-coordinate arrays follow the given
+// index order, so a stop keeps its radius, bearing, approach and hint
+// wherever it lands. Arrays the caller left empty stay empty.
+static void
+osrmc_trip_subset_params_helper(const osrm::TripParameters& params,
+                                const std::vector<size_t>& indices,
+                                osrm::engine::api::BaseParameters& subset) {
+  subset.exclude = params.exclude;
+  subset.generate_hints = params.generate_hints;
+  subset.skip_waypoints = params.skip_waypoints;
+  subset.snapping = params.snapping;
+  subset.coordinates.reserve(indices.size());
+  for (const auto index : indices) {
+    subset.coordinates.push_back(params.coordinates[index]);
+  }
+  if (params.hints.size() == params.coordinates.size()) {
+    subset.hints.reserve(indices.size());
+    for (const auto index : indices) {
+      subset.hints.push_back(params.hints[index]);
+    }
+  }
+  if (params.radiuses.size() == params.coordinates.size()) {
+    subset.radiuses.reserve(indices.size());
+    for (const auto index : indices) {
+      subset.radiuses.push_back(params.radiuses[index]);
+    }
+  }
+  if (params.bearings.size() == params.coordinates.size()) {
+    subset.bearings.reserve(indices.size());
+    for (const auto index : indices) {
+      subset.bearings.push_back(params.bearings[index]);
+    }
+  }
+  if (params.approaches.size() == params.coordinates.size()) {
+    subset.approaches.reserve(indices.size());
+    for (const auto index : indices) {
+      subset.approaches.push_back(params.approaches[index]);
+    }
+  }
+}
+
+// Solves one sweep cluster as an open sub-trip and reports the visiting
+// order within the cluster (indices into cluster_indices)
+static void
+osrmc_trip_cluster_helper(osrm::OSRM& engine,
+                          const osrm::TripParameters& params,
+                          const std::vector<size_t>& cluster_indices,
+                          std::vector<size_t>& order_out,
+                          osrmc_error_t* cluster_error) {
+  osrm::TripParameters cluster_params;
+  cluster_params.format = osrm::engine::api::BaseParameters::OutputFormatType::FLATBUFFERS;
+  cluster_params.roundtrip = false;
+  cluster_params.continue_straight = params.continue_straight;
+  osrmc_trip_subset_params_helper(params, cluster_indices, cluster_params);
+  // Order recovery reads the waypoints, even when the caller asked to skip
+  // them in the final result
+  cluster_params.skip_waypoints = false;
+
+  osrm::engine::api::ResultT result = osrmc_builder_acquire();
+  const auto status = engine.Trip(cluster_params, result);
+  auto* builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result);
+
+  if (status != osrm::Status::Ok || !builder || !osrmc_trip_order_helper(*builder, order_out)) {
+    osrmc_set_error(cluster_error, "TripError", "Parallel trip cluster failed");
+  }
+  if (builder) {
+    osrmc_builder_release(std::move(*builder));
+  }
+}
+
+osrmc_trip_response_t
+osrmc_trip_parallel(osrmc_osrm_t osrm,
+                    osrmc_trip_params_t params,
+                    unsigned cluster_count,
+                    size_t* out_order,
+                    osrmc_error_t* error) try {
+  if (!osrm) {
+    osrmc_set_error(error, "InvalidArgument", "OSRM instance must not be null");
+    return nullptr;
+  }
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
+  auto* params_typed = reinterpret_cast<osrm::TripParameters*>(params);
+  const auto coordinate_count = params_typed->coordinates.size();
+  const auto start = std::chrono::steady_clock::now();
+
+  // Too small to split, nothing to fan out across, or fixed-endpoint
+  // constraints (source=first/destination=last) that bind the tour globally
+  // and cannot survive the clustered stitch: plain solver
+  auto* pool = wrapper->pool.get();
+  const bool endpoint_constrained = params_typed->source != osrm::TripParameters::SourceType::Any ||
+                                    params_typed->destination != osrm::TripParameters::DestinationType::Any;
+  if (cluster_count <= 1 || !pool || endpoint_constrained ||
+      coordinate_count < static_cast<size_t>(cluster_count) * 2) {
+    auto response = osrmc_trip(osrm, params, error);
+    if (response && out_order) {
+      auto* resp = reinterpret_cast<osrmc_response*>(response);
+      std::vector<size_t> order;
+      const auto* payload = osrmc_trip_payload_helper(*resp);
+      if (!payload || !osrmc_trip_order_helper(payload, order)) {
+        // out_order promises the visiting order; a response it cannot be
+        // recovered from is no use to the caller
+        osrmc_trip_response_destruct(response);
+        osrmc_set_error(error, "TripError", "Trip result carries no visiting order");
+        return nullptr;
+      }
+      std::copy(order.begin(), order.end(), out_order);
+    }
+    return response;
+  }
+
+  const auto engine_ref = wrapper->engine_snapshot();
+  if (!engine_ref) {
+    osrmc_set_error(error, "NotReady", "Engine is still loading");
+    return nullptr;
+  }
+  auto& engine = *engine_ref;
+  osrmc_stats_scope stats;
+  stats.arm(wrapper->stats, OSRMC_SERVICE_TRIP);
+
+  // Sweep clustering: order the stops by polar angle around their centroid
+  // and cut the sweep into cluster_count contiguous arcs, so neighbouring
+  // stops land in the same sub-problem
+  double centroid_lon = 0;
+  double centroid_lat = 0;
+  for (const auto& coordinate : params_typed->coordinates) {
+    centroid_lon += static_cast<double>(static_cast<int32_t>(coordinate.lon));
+    centroid_lat += static_cast<double>(static_cast<int32_t>(coordinate.lat));
+  }
+  centroid_lon /= static_cast<double>(coordinate_count);
+  centroid_lat /= static_cast<double>(coordinate_count);
+
+  std::vector<size_t> by_angle(coordinate_count);
+  for (size_t i = 0; i < coordinate_count; ++i) {
+    by_angle[i] = i;
+  }
+  std::sort(by_angle.begin(), by_angle.end(), [&](size_t a, size_t b) {
+    const auto& first = params_typed->coordinates[a];
+    const auto& second = params_typed->coordinates[b];
+    const double first_angle = std::atan2(static_cast<double>(static_cast<int32_t>(first.lat)) - centroid_lat,
+                                          static_cast<double>(static_cast<int32_t>(first.lon)) - centroid_lon);
+    const double second_angle = std::atan2(static_cast<double>(static_cast<int32_t>(second.lat)) - centroid_lat,
+                                           static_cast<double>(static_cast<int32_t>(second.lon)) - centroid_lon);
+    return first_angle < second_angle;
+  });
+
+  std::vector<std::vector<size_t>> clusters(cluster_count);
+  const size_t base_size = coordinate_count / cluster_count;
+  const size_t extra = coordinate_count % cluster_count;
+  size_t cursor = 0;
+  for (size_t cluster = 0; cluster < cluster_count; ++cluster) {
+    const size_t cluster_size = base_size + (cluster < extra ? 1 : 0);
+    clusters[cluster].assign(by_angle.begin() + static_cast<ptrdiff_t>(cursor),
+                             by_angle.begin() + static_cast<ptrdiff_t>(cursor + cluster_size));
+    cursor += cluster_size;
+  }
+
+  // Solve the clusters as independent open sub-trips across the pool
+  std::vector<std::vector<size_t>> cluster_orders(cluster_count);
+  std::vector<osrmc_error_t> cluster_errors(cluster_count, nullptr);
+  std::mutex done_mutex;
+  std::condition_variable done_condition;
+  size_t remaining = cluster_count;
+  for (size_t cluster = 0; cluster < cluster_count; ++cluster) {
+    pool->submit([&, cluster] {
+      osrmc_trip_cluster_helper(engine, *params_typed, clusters[cluster], cluster_orders[cluster],
+                                &cluster_errors[cluster]);
+      {
+        std::lock_guard<std::mutex> lock(done_mutex);
+        --remaining;
+      }
+      done_condition.notify_one();
+    });
+  }
+  {
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_condition.wait(lock, [&] { return remaining == 0; });
+  }
+  for (size_t cluster = 0; cluster < cluster_count; ++cluster) {
+    if (cluster_errors[cluster]) {
+      if (error) {
+        *error = cluster_errors[cluster];
+        cluster_errors[cluster] = nullptr;
+      }
+      for (size_t rest = cluster; rest < cluster_count; ++rest) {
+        osrmc_error_destruct(cluster_errors[rest]);
+        cluster_errors[rest] = nullptr;
+      }
+      return nullptr;
+    }
+  }
+
+  // Stitch: the sweep already orders the clusters around the centroid, so
+  // concatenating the per-cluster tours yields the global visiting order
+  std::vector<size_t> tour;
+  tour.reserve(coordinate_count);
+  for (size_t cluster = 0; cluster < cluster_count; ++cluster) {
+    for (const auto within : cluster_orders[cluster]) {
+      tour.push_back(clusters[cluster][within]);
+    }
+  }
+
+  // Render the stitched tour with a single route query over the ordered
+  // stops, closing the loop for roundtrips
+  osrm::RouteParameters tour_params;
+  tour_params.format = osrm::engine::api::BaseParameters::OutputFormatType::FLATBUFFERS;
+  tour_params.steps = params_typed->steps;
+  tour_params.annotations = params_typed->annotations;
+  tour_params.annotations_type = params_typed->annotations_type;
+  tour_params.geometries = params_typed->geometries;
+  tour_params.overview = params_typed->overview;
+  tour_params.continue_straight = params_typed->continue_straight;
+  auto render_stops = tour;
+  if (params_typed->roundtrip && !tour.empty()) {
+    render_stops.push_back(tour.front());
+  }
+  osrmc_trip_subset_params_helper(*params_typed, render_stops, tour_params);
+
+  osrm::engine::api::ResultT result = osrmc_builder_acquire();
+  const auto status = engine.Route(tour_params, result);
+  auto* tour_builder = std::get_if<flatbuffers::FlatBufferBuilder>(&result);
+  if (status != osrm::Status::Ok || !tour_builder) {
+    osrmc_set_error(error, "TripError", "Failed to render stitched tour");
+    if (tour_builder) {
+      osrmc_builder_release(std::move(*tour_builder));
+    }
+    return nullptr;
+  }
+
+  // With budget to spare, also run the exact solver and keep the better
+  // tour; the solver cannot be preempted, so the budget gates the attempt
+  const auto budget_ms = osrmc_params_metadata_get(params).time_budget_ms;
+  if (budget_ms > 0) {
+    const auto elapsed_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    if (elapsed_ms < budget_ms) {
+      osrmc_error_t exact_error = nullptr;
+      auto exact_response = osrmc_trip(osrm, params, &exact_error);
+      if (exact_response) {
+        auto* exact = reinterpret_cast<osrmc_response*>(exact_response);
+        const auto* exact_payload = osrmc_trip_payload_helper(*exact);
+        if (exact_payload &&
+            osrmc_first_route_duration_helper(exact_payload) < osrmc_first_route_duration_helper(*tour_builder)) {
+          // Prefer the exact tour only when its visiting order is
+          // recoverable; otherwise fall through to the stitched tour,
+          // whose order is always known
+          std::vector<size_t> exact_order;
+          if (!out_order || osrmc_trip_order_helper(exact_payload, exact_order)) {
+            if (out_order) {
+              std::copy(exact_order.begin(), exact_order.end(), out_order);
+            }
+            osrmc_builder_release(std::move(*tour_builder));
+            stats.failed = false;
+            return exact_response;
+          }
+        }
+        osrmc_trip_response_destruct(exact_response);
+      }
+      if (exact_error) {
+        osrmc_error_destruct(exact_error);
+      }
+    }
+  }
+
+  if (out_order) {
+    std::copy(tour.begin(), tour.end(), out_order);
+  }
+  stats.failed = false;
+  stats.bytes = tour_builder->GetSize();
+  auto* out = new osrmc_response{std::move(result), {}, {}, osrmc_thread_arena() != nullptr};
+  return reinterpret_cast<osrmc_trip_response_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+osrmc_request_t
+osrmc_trip_submit(osrmc_osrm_t osrm,
+                  osrmc_trip_params_t params,
+                  osrmc_completion_t callback,
+                  void* user_data,
+                  osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  return osrmc_submit_helper(
+    osrm,
+    params,
+    [osrm, params](osrmc_error_t* task_error) -> void* { return osrmc_trip(osrm, params, task_error); },
+    [](void* response) { osrmc_trip_response_destruct(reinterpret_cast<osrmc_trip_response_t>(response)); },
+    callback,
+    user_data,
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
 /* Tile */
 
 osrmc_tile_params_t
@@ -3201,10 +7298,39 @@ osrmc_tile_params_construct(osrmc_error_t* error) try {
 void
 osrmc_tile_params_destruct(osrmc_tile_params_t params) {
   if (params) {
+    osrmc_params_metadata_erase(params);
     delete reinterpret_cast<osrm::TileParameters*>(params);
   }
 }
 
+osrmc_tile_params_t
+osrmc_tile_params_clone(osrmc_tile_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  auto* out = new osrm::TileParameters(*reinterpret_cast<osrm::TileParameters*>(params));
+  osrmc_params_metadata_clone_helper(params, out);
+  return reinterpret_cast<osrmc_tile_params_t>(out);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
+
+void
+osrmc_tile_params_reset(osrmc_tile_params_t params, osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return;
+  }
+  auto* params_typed = reinterpret_cast<osrm::TileParameters*>(params);
+  params_typed->x = 0;
+  params_typed->y = 0;
+  params_typed->z = 0;
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+}
+
 void
 osrmc_tile_params_set_x(osrmc_tile_params_t params, unsigned x, osrmc_error_t* error) try {
   if (!params) {
@@ -3299,15 +7425,37 @@ osrmc_tile(osrmc_osrm_t osrm, osrmc_tile_params_t params, osrmc_error_t* error)
     osrmc_set_error(error, "InvalidArgument", "Params must not be null");
     return nullptr;
   }
-  auto* osrm_typed = reinterpret_cast<osrm::OSRM*>(osrm);
+  auto* wrapper = reinterpret_cast<osrmc_osrm*>(osrm);
   auto* params_typed = reinterpret_cast<osrm::TileParameters*>(params);
 
+  auto* tile_cache = wrapper->tile_cache;
+  const auto tile_key = osrmc_tile_cache::key(params_typed->x, params_typed->y, params_typed->z);
+  if (tile_cache) {
+    if (auto cached = tile_cache->lookup(tile_key)) {
+      auto* out = new osrmc_tile_response{std::move(cached)};
+      return reinterpret_cast<osrmc_tile_response_t>(out);
+    }
+  }
+
   // Tile returns binary data as std::string (not JSON Object)
   osrm::engine::api::ResultT result = std::string();
-  const auto status = osrm_typed->Tile(*params_typed, result);
+  const auto tile_engine = wrapper->engine_snapshot();
+  if (!tile_engine) {
+    osrmc_set_error(error, "NotReady", "Engine is still loading");
+    return nullptr;
+  }
+  osrmc_stats_scope stats;
+  stats.arm(wrapper->stats, OSRMC_SERVICE_TILE);
+  const auto status = tile_engine->Tile(*params_typed, result);
 
   if (status == osrm::Status::Ok) {
-    auto* out = new std::string(std::move(std::get<std::string>(result)));
+    auto payload = std::make_shared<const std::string>(std::move(std::get<std::string>(result)));
+    stats.failed = false;
+    stats.bytes = payload->size();
+    if (tile_cache) {
+      tile_cache->store(tile_key, payload);
+    }
+    auto* out = new osrmc_tile_response{std::move(payload)};
     return reinterpret_cast<osrmc_tile_response_t>(out);
   }
 
@@ -3334,7 +7482,7 @@ osrmc_tile(osrmc_osrm_t osrm, osrmc_tile_params_t params, osrmc_error_t* error)
 void
 osrmc_tile_response_destruct(osrmc_tile_response_t response) {
   if (response) {
-    delete reinterpret_cast<std::string*>(response);
+    delete reinterpret_cast<osrmc_tile_response*>(response);
   }
 }
 
@@ -3344,8 +7492,8 @@ osrmc_tile_response_size(osrmc_tile_response_t response, osrmc_error_t* error) t
     osrmc_set_error(error, "InvalidArgument", "Response must not be null");
     return 0;
   }
-  auto* response_typed = reinterpret_cast<std::string*>(response);
-  return response_typed->size();
+  auto* response_typed = reinterpret_cast<osrmc_tile_response*>(response);
+  return response_typed->data->size();
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
   return 0;
@@ -3360,13 +7508,13 @@ osrmc_tile_response_data(osrmc_tile_response_t response, size_t* size, osrmc_err
     }
     return nullptr;
   }
-  auto* response_typed = reinterpret_cast<std::string*>(response);
+  auto* response_typed = reinterpret_cast<osrmc_tile_response*>(response);
 
   if (size) {
-    *size = response_typed->size();
+    *size = response_typed->data->size();
   }
 
-  return response_typed->data();
+  return response_typed->data->data();
 } catch (const std::exception& e) {
   osrmc_error_from_exception(e, error);
   if (size) {
@@ -3374,3 +7522,26 @@ osrmc_tile_response_data(osrmc_tile_response_t response, size_t* size, osrmc_err
   }
   return nullptr;
 }
+
+osrmc_request_t
+osrmc_tile_submit(osrmc_osrm_t osrm,
+                  osrmc_tile_params_t params,
+                  osrmc_completion_t callback,
+                  void* user_data,
+                  osrmc_error_t* error) try {
+  if (!params) {
+    osrmc_set_error(error, "InvalidArgument", "Params must not be null");
+    return nullptr;
+  }
+  return osrmc_submit_helper(
+    osrm,
+    params,
+    [osrm, params](osrmc_error_t* task_error) -> void* { return osrmc_tile(osrm, params, task_error); },
+    [](void* response) { osrmc_tile_response_destruct(reinterpret_cast<osrmc_tile_response_t>(response)); },
+    callback,
+    user_data,
+    error);
+} catch (const std::exception& e) {
+  osrmc_error_from_exception(e, error);
+  return nullptr;
+}
@@ -92,6 +92,25 @@ typedef struct osrmc_error* osrmc_error_t;
 typedef struct osrmc_config* osrmc_config_t;
 // OSRM
 typedef struct osrmc_osrm* osrmc_osrm_t;
+// Registry (named multi-dataset engine container)
+typedef struct osrmc_registry* osrmc_registry_t;
+// Request (asynchronous service call)
+typedef struct osrmc_request* osrmc_request_t;
+// Queue (pipelined request submission)
+typedef struct osrmc_queue* osrmc_queue_t;
+/** Opaque type: Hint cache */
+typedef struct osrmc_hint_cache* osrmc_hint_cache_t;
+/** Opaque type: Result cache */
+typedef struct osrmc_result_cache* osrmc_result_cache_t;
+/** Opaque type: Match session */
+typedef struct osrmc_match_session* osrmc_match_session_t;
+/** Opaque type: Tile cache */
+typedef struct osrmc_tile_cache* osrmc_tile_cache_t;
+/** Opaque type: Request arena */
+typedef struct osrmc_arena* osrmc_arena_t;
+// Completion callback, invoked on an internal worker thread once a submitted
+// request finishes. The request handle stays valid inside the callback.
+typedef void (*osrmc_completion_t)(osrmc_request_t request, void* user_data);
 // Base
 typedef struct osrmc_params* osrmc_params_t;
 // Nearest
@@ -151,6 +170,38 @@ typedef enum { MATCH_GAPS_SPLIT = 0, MATCH_GAPS_IGNORE = 1 } match_gaps_type_t;
 typedef enum { TRIP_SOURCE_ANY = 0, TRIP_SOURCE_FIRST = 1 } trip_source_type_t;
 // Trip destination
 typedef enum { TRIP_DESTINATION_ANY = 0, TRIP_DESTINATION_LAST = 1 } trip_destination_type_t;
+// Prefault policy for dataset files at engine construction
+typedef enum { PREFAULT_NONE = 0, PREFAULT_READAHEAD = 1, PREFAULT_FULL = 2 } prefault_policy_t;
+// Service identifiers for runtime statistics
+typedef enum {
+  OSRMC_SERVICE_ROUTE = 0,
+  OSRMC_SERVICE_TABLE = 1,
+  OSRMC_SERVICE_MATCH = 2,
+  OSRMC_SERVICE_TRIP = 3,
+  OSRMC_SERVICE_NEAREST = 4,
+  OSRMC_SERVICE_TILE = 5,
+  OSRMC_SERVICE_COUNT = 6
+} osrmc_service_t;
+// Error identifiers (numeric fast path for common OSRM and wrapper error codes)
+typedef enum {
+  ERROR_ID_UNKNOWN = 0,
+  ERROR_ID_INVALID_URL = 1,
+  ERROR_ID_INVALID_SERVICE = 2,
+  ERROR_ID_INVALID_VERSION = 3,
+  ERROR_ID_INVALID_OPTIONS = 4,
+  ERROR_ID_INVALID_QUERY = 5,
+  ERROR_ID_INVALID_VALUE = 6,
+  ERROR_ID_NO_SEGMENT = 7,
+  ERROR_ID_TOO_BIG = 8,
+  ERROR_ID_NO_ROUTE = 9,
+  ERROR_ID_NO_TABLE = 10,
+  ERROR_ID_NOT_IMPLEMENTED = 11,
+  ERROR_ID_NO_MATCH = 12,
+  ERROR_ID_NO_TRIPS = 13,
+  ERROR_ID_INVALID_ARGUMENT = 14,
+  ERROR_ID_TIMEOUT = 15,
+  ERROR_ID_CANCELLED = 16
+} error_id_t;
 
 /* Error*/
 
@@ -159,6 +210,11 @@ OSRMC_API const char*
 osrmc_error_code(osrmc_error_t error);
 OSRMC_API const char*
 osrmc_error_message(osrmc_error_t error);
+/** Returns the numeric identifier of the error, ERROR_ID_UNKNOWN for codes
+ *  outside the table. Checking the id instead of osrmc_error_code() keeps the
+ *  check-and-drop error path free of string comparisons. */
+OSRMC_API error_id_t
+osrmc_error_id(osrmc_error_t error);
 // Error destructor
 OSRMC_API void
 osrmc_error_destruct(osrmc_error_t error);
@@ -213,6 +269,27 @@ osrmc_config_set_memory_file(osrmc_config_t config, const char* memory_file, osr
  *  to this function on the same thread. Callers must copy the string if they need to keep it. */
 OSRMC_API void
 osrmc_config_get_memory_file(osrmc_config_t config, const char** out_memory_file, osrmc_error_t* error);
+/** Sets how dataset files are faulted into memory at engine construction.
+ *  PREFAULT_NONE loads lazily (mmap-backed datasets then pay page-fault
+ *  storms on the first requests), PREFAULT_READAHEAD asks the OS to read the
+ *  files ahead asynchronously, PREFAULT_FULL touches every page up front,
+ *  trading the longest startup for no first-request faults. Only applies to
+ *  file-backed datasets (a base path was given at config construction). */
+OSRMC_API void
+osrmc_config_set_prefault_policy(osrmc_config_t config, prefault_policy_t policy, osrmc_error_t* error);
+OSRMC_API void
+osrmc_config_get_prefault_policy(osrmc_config_t config, prefault_policy_t* out_policy, osrmc_error_t* error);
+/** Buffer-filling variant of osrmc_config_get_memory_file(): writes the
+ *  NUL-terminated path directly into caller memory, avoiding the thread-local
+ *  storage and its next-call lifetime limit. If out_needed is non-null, it is
+ *  set to the required capacity in bytes including the terminator; fails with
+ *  BufferTooSmall when capacity is insufficient. */
+OSRMC_API void
+osrmc_config_get_memory_file_buf(osrmc_config_t config,
+                                 char* buf,
+                                 size_t capacity,
+                                 size_t* out_needed,
+                                 osrmc_error_t* error);
 OSRMC_API void
 osrmc_config_set_use_mmap(osrmc_config_t config, bool use_mmap, osrmc_error_t* error);
 OSRMC_API void
@@ -240,6 +317,14 @@ OSRMC_API void
 osrmc_config_get_dataset_name(osrmc_config_t config, const char** out_dataset_name, osrmc_error_t* error);
 OSRMC_API void
 osrmc_config_clear_disabled_feature_datasets(osrmc_config_t config, osrmc_error_t* error);
+/** Sets the number of worker threads owned by OSRM instances built from this config.
+ *  Batch entry points (osrmc_route_batch, osrmc_table_batch, osrmc_nearest_batch) fan
+ *  their requests out across this pool. 0 (the default) disables the pool; batches
+ *  then execute sequentially on the calling thread. */
+OSRMC_API void
+osrmc_config_set_worker_threads(osrmc_config_t config, unsigned worker_threads, osrmc_error_t* error);
+OSRMC_API void
+osrmc_config_get_worker_threads(osrmc_config_t config, unsigned* out_worker_threads, osrmc_error_t* error);
 
 /* OSRM */
 
@@ -248,6 +333,311 @@ OSRMC_API osrmc_osrm_t
 osrmc_osrm_construct(osrmc_config_t config, osrmc_error_t* error);
 OSRMC_API void
 osrmc_osrm_destruct(osrmc_osrm_t osrm);
+/** Constructs the engine on a background thread and returns the handle
+ *  immediately, so a service can bind its port while the dataset loads.
+ *  Service calls made before the engine is ready fail with a NotReady error;
+ *  readiness is observed via osrmc_osrm_is_ready() or osrmc_osrm_wait_ready().
+ *  A construction failure is reported by the first readiness call that sees
+ *  it. */
+OSRMC_API osrmc_osrm_t
+osrmc_osrm_construct_async(osrmc_config_t config, osrmc_error_t* error);
+// Returns 1 once the engine is ready (or construction failed), 0 while loading
+OSRMC_API int
+osrmc_osrm_is_ready(osrmc_osrm_t osrm, osrmc_error_t* error);
+// Blocks until the engine is ready; reports a construction failure through error
+OSRMC_API void
+osrmc_osrm_wait_ready(osrmc_osrm_t osrm, osrmc_error_t* error);
+/** Swaps the handle over to a freshly built engine for the given config
+ *  without dropping in-flight work: the calling thread blocks for the engine
+ *  construction, requests issued meanwhile keep running against the old
+ *  dataset, and the swap itself is atomic. The old engine is torn down once
+ *  its last in-flight request drains. Attached hint/result/tile caches are
+ *  cleared, since their contents derive from the old dataset. */
+OSRMC_API void
+osrmc_osrm_reload(osrmc_osrm_t osrm, osrmc_config_t config, osrmc_error_t* error);
+
+/* Stats */
+
+/* Latency histogram bucket count. Bucket i counts requests whose latency fell
+ * in [2^i, 2^(i+1)) microseconds; the last bucket absorbs everything slower. */
+#define OSRMC_STATS_HISTOGRAM_BUCKETS 28
+
+// Per-service counters as captured by osrmc_stats_snapshot()
+typedef struct {
+  unsigned long long calls;
+  unsigned long long errors;
+  unsigned long long total_us;
+  unsigned long long max_us;
+  /** Bytes produced through the FlatBuffer path (builder size at completion) */
+  unsigned long long bytes_out;
+  unsigned long long latency_histogram[OSRMC_STATS_HISTOGRAM_BUCKETS];
+} osrmc_service_stats_t;
+
+// Snapshot across all services, indexed by osrmc_service_t
+typedef struct {
+  osrmc_service_stats_t services[OSRMC_SERVICE_COUNT];
+} osrmc_stats_t;
+
+/** Enables per-service call/error/latency/bytes counters on the handle.
+ *  Recording uses relaxed atomics touched only when enabled, so the cost on
+ *  the request hot path is a few nanoseconds and zero when disabled. Counters
+ *  survive disable/enable cycles until osrmc_stats_reset(). */
+OSRMC_API void
+osrmc_stats_enable(osrmc_osrm_t osrm, osrmc_error_t* error);
+OSRMC_API void
+osrmc_stats_disable(osrmc_osrm_t osrm, osrmc_error_t* error);
+// Zeroes all counters; the enabled state is unchanged
+OSRMC_API void
+osrmc_stats_reset(osrmc_osrm_t osrm, osrmc_error_t* error);
+/** Copies the current counters into out_stats. The snapshot is tear-free per
+ *  counter but not across counters: totals taken mid-request may be off by one
+ *  relative to each other, which is fine for monitoring. */
+OSRMC_API void
+osrmc_stats_snapshot(osrmc_osrm_t osrm, osrmc_stats_t* out_stats, osrmc_error_t* error);
+
+/* Registry */
+
+/** A registry owns engines for multiple datasets served from one process and
+ *  routes lookups by name (e.g. "europe-truck"). Engines are constructed
+ *  lazily on first lookup, or eagerly in parallel via
+ *  osrmc_registry_preload(). Entries registered with identical dataset
+ *  identity (base path, or dataset name for shared memory) share one
+ *  underlying engine instance, so the data is resident once. */
+OSRMC_API osrmc_registry_t
+osrmc_registry_construct(osrmc_error_t* error);
+// Destroys the registry and every engine it owns
+OSRMC_API void
+osrmc_registry_destruct(osrmc_registry_t registry);
+/** Registers a config under a name. The configuration is copied, so the
+ *  config handle can be destructed afterwards; registering a name twice is an
+ *  error. */
+OSRMC_API void
+osrmc_registry_add(osrmc_registry_t registry, const char* name, osrmc_config_t config, osrmc_error_t* error);
+/** Returns the engine registered under name, constructing it on first use.
+ *  The handle is borrowed: it stays valid until osrmc_registry_destruct() and
+ *  must not be passed to osrmc_osrm_destruct(). Lookups after construction
+ *  take only a shared lock. A failed construction is reported on every lookup
+ *  of that name. */
+OSRMC_API osrmc_osrm_t
+osrmc_registry_get(osrmc_registry_t registry, const char* name, osrmc_error_t* error);
+/** Constructs all engines that are not built yet, one thread per missing
+ *  dataset, and blocks until they are done. The first failure is reported
+ *  through error; the remaining engines are still built. */
+OSRMC_API void
+osrmc_registry_preload(osrmc_registry_t registry, osrmc_error_t* error);
+
+/* Hint cache */
+
+/*
+ * Library-managed cache of snapping hints keyed by quantized coordinates.
+ * Attached to an osrm handle, it is consulted automatically before every
+ * service call: coordinates without an explicit hint that match a cached
+ * entry get the cached hint injected, skipping the nearest-neighbor phase
+ * inside the engine, and successful responses refill the cache from their
+ * waypoint hints. Reads take a per-shard shared lock, so concurrent service
+ * calls do not serialize against each other.
+ */
+
+/** Constructs a hint cache holding at most capacity entries. The cache must
+ *  outlive every osrm handle it is attached to. */
+OSRMC_API osrmc_hint_cache_t
+osrmc_hint_cache_construct(size_t capacity, osrmc_error_t* error);
+OSRMC_API void
+osrmc_hint_cache_destruct(osrmc_hint_cache_t cache);
+/** Sets how many decimal digits of the coordinate are significant for cache
+ *  lookups (1-6, default 5, roughly one meter). Changing the precision
+ *  clears the cache. */
+OSRMC_API void
+osrmc_hint_cache_set_precision(osrmc_hint_cache_t cache, unsigned decimal_digits, osrmc_error_t* error);
+// Cache observability: entry count and hit/miss counters since construction
+OSRMC_API void
+osrmc_hint_cache_stats(osrmc_hint_cache_t cache,
+                       size_t* out_entries,
+                       size_t* out_hits,
+                       size_t* out_misses,
+                       osrmc_error_t* error);
+/** Attaches the cache to an osrm handle; NULL detaches. The cache may be
+ *  shared between several osrm handles serving the same network. */
+OSRMC_API void
+osrmc_osrm_set_hint_cache(osrmc_osrm_t osrm, osrmc_hint_cache_t cache, osrmc_error_t* error);
+
+/* Result cache */
+
+/*
+ * Opt-in cache of complete service responses, keyed by the fully populated
+ * params object (coordinates, radiuses, bearings, exclude list and all
+ * service-specific options). Attached to an osrm handle, it serves repeated
+ * identical requests straight from memory without touching the engine; hits
+ * are delivered through the usual transfer/view response API. Entries expire
+ * after the configured TTL and total payload size stays within an
+ * approximate byte budget.
+ */
+
+/** Constructs a result cache with the given byte budget and entry TTL. The
+ *  cache must outlive every osrm handle it is attached to. */
+OSRMC_API osrmc_result_cache_t
+osrmc_result_cache_construct(size_t max_bytes, int64_t ttl_ms, osrmc_error_t* error);
+OSRMC_API void
+osrmc_result_cache_destruct(osrmc_result_cache_t cache);
+// Cache observability: entry count, resident payload bytes and hit/miss counters
+OSRMC_API void
+osrmc_result_cache_stats(osrmc_result_cache_t cache,
+                         size_t* out_entries,
+                         size_t* out_bytes,
+                         size_t* out_hits,
+                         size_t* out_misses,
+                         osrmc_error_t* error);
+/** Attaches the cache to an osrm handle; NULL detaches. Do not share one
+ *  cache between handles serving different networks: the key covers request
+ *  parameters only, not the dataset. */
+OSRMC_API void
+osrmc_osrm_set_result_cache(osrmc_osrm_t osrm, osrmc_result_cache_t cache, osrmc_error_t* error);
+
+/* Tile cache */
+
+/*
+ * Opt-in LRU cache for rendered vector tiles, keyed by z/x/y. Tile content
+ * only changes when the dataset changes, so attached to an osrm handle the
+ * cache serves repeated osrmc_tile() calls without re-rendering the MVT
+ * payload; cached buffers are delivered through the usual
+ * osrmc_tile_response_data() contract.
+ */
+
+/** Constructs a tile cache with the given payload byte budget. The cache must
+ *  outlive every osrm handle it is attached to. */
+OSRMC_API osrmc_tile_cache_t
+osrmc_tile_cache_construct(size_t max_bytes, osrmc_error_t* error);
+OSRMC_API void
+osrmc_tile_cache_destruct(osrmc_tile_cache_t cache);
+/** Drops every cached tile. Call after the underlying dataset changes. */
+OSRMC_API void
+osrmc_tile_cache_clear(osrmc_tile_cache_t cache, osrmc_error_t* error);
+// Cache observability: entry count, resident payload bytes and hit/miss counters
+OSRMC_API void
+osrmc_tile_cache_stats(osrmc_tile_cache_t cache,
+                       size_t* out_entries,
+                       size_t* out_bytes,
+                       size_t* out_hits,
+                       size_t* out_misses,
+                       osrmc_error_t* error);
+/** Attaches the cache to an osrm handle; NULL detaches. Do not share one
+ *  cache between handles serving different networks. */
+OSRMC_API void
+osrmc_osrm_set_tile_cache(osrmc_osrm_t osrm, osrmc_tile_cache_t cache, osrmc_error_t* error);
+
+/* Arena */
+
+/** A bump allocator for request-lifetime allocations. Once installed on a
+ *  thread with osrmc_arena_install(), response builders for requests issued
+ *  from that thread draw their memory from the arena, and
+ *  osrmc_arena_reset() reclaims all of it with a single pointer store
+ *  instead of individual frees. Allocations that do not fit fall back to the
+ *  heap, so an undersized arena degrades gracefully rather than failing.
+ *
+ *  Lifetime rules: responses produced while an arena was installed reference
+ *  arena memory and must be destructed before the arena is reset or
+ *  destructed; transferring such a response copies the payload out, so the
+ *  transferred buffer is safe past a reset. An arena is single-threaded:
+ *  install it on one thread at a time. */
+OSRMC_API osrmc_arena_t
+osrmc_arena_construct(size_t bytes, osrmc_error_t* error);
+// Destroys the arena; uninstalls it from the calling thread if installed
+OSRMC_API void
+osrmc_arena_destruct(osrmc_arena_t arena);
+/** Installs the arena as the calling thread's request allocator; NULL
+ *  uninstalls. Only affects requests issued from this thread. */
+OSRMC_API void
+osrmc_arena_install(osrmc_arena_t arena, osrmc_error_t* error);
+/** Reclaims all arena memory at once. All responses produced under the arena
+ *  must have been destructed first. */
+OSRMC_API void
+osrmc_arena_reset(osrmc_arena_t arena, osrmc_error_t* error);
+/** Reports bytes currently allocated from the arena block and the number of
+ *  allocations that overflowed to the heap; size the arena so the overflow
+ *  count stays at zero. */
+OSRMC_API void
+osrmc_arena_usage(osrmc_arena_t arena, size_t* out_used, size_t* out_overflow, osrmc_error_t* error);
+
+/* Request */
+
+/*
+ * Asynchronous submission: each service provides an osrmc_*_submit() variant
+ * that enqueues the request on the worker pool (which must be configured via
+ * osrmc_config_set_worker_threads()) and returns immediately with a request
+ * handle. Completion is signalled through the optional callback and can also
+ * be observed by polling or waiting on the handle. The params object must
+ * stay valid and unmodified until the request completes.
+ */
+
+// Returns 1 once the request has completed, 0 while it is still in flight
+OSRMC_API int
+osrmc_request_poll(osrmc_request_t request, osrmc_error_t* error);
+// Blocks until the request has completed
+OSRMC_API void
+osrmc_request_wait(osrmc_request_t request, osrmc_error_t* error);
+/** Requests cancellation. A request that has not yet started on a worker
+ *  completes with a Cancelled error instead of running; work that is already
+ *  executing inside the engine cannot be interrupted and finishes normally.
+ *  Safe to call at any point in the request lifetime. */
+OSRMC_API void
+osrmc_request_cancel(osrmc_request_t request, osrmc_error_t* error);
+/** Transfers the result out of a completed request. Returns the service
+ *  response (cast it to the osrmc_*_response_t matching the submit call) or
+ *  NULL if the request failed, in which case the request's error is
+ *  transferred to the error output parameter. The caller owns the returned
+ *  response and any transferred error. */
+OSRMC_API void*
+osrmc_request_response(osrmc_request_t request, osrmc_error_t* error);
+/** Releases the request handle. Any result not taken via
+ *  osrmc_request_response() is freed. Destructing a request that is still in
+ *  flight is safe: the computation finishes in the background (the completion
+ *  callback may still fire) and its result is discarded. */
+OSRMC_API void
+osrmc_request_destruct(osrmc_request_t request);
+
+/* Queue */
+
+/** A submission queue for bindings that can only enter the library on one
+ *  thread at a time (e.g. under an interpreter lock): the caller pushes many
+ *  requests in one stretch, the queue's own workers execute them, and
+ *  completed responses are drained in batches. Push order does not dictate
+ *  completion order; tickets correlate responses with their requests. */
+OSRMC_API osrmc_queue_t
+osrmc_queue_construct(osrmc_osrm_t osrm, unsigned n_workers, osrmc_error_t* error);
+/** Destroys the queue: pending requests are dropped, running ones finish,
+ *  and undrained responses are released. The osrm handle must outlive the
+ *  queue. */
+OSRMC_API void
+osrmc_queue_destruct(osrmc_queue_t queue);
+/** Enqueues a request and returns its ticket (never 0; 0 signals failure).
+ *  params is the service's params handle cast to void*; the caller keeps
+ *  ownership and must not mutate or destruct it until the ticket has been
+ *  drained. */
+OSRMC_API uint64_t
+osrmc_queue_push(osrmc_queue_t queue, osrmc_service_t service, void* params, osrmc_error_t* error);
+/** Drains up to max completed requests without blocking. For each drained
+ *  request, the ticket, the response handle (cast to void*; null on failure)
+ *  and the per-request error (null on success) are stored at the same index
+ *  of the output arrays. Returns the number drained. Ownership of responses
+ *  and errors passes to the caller: destroy them with the service's
+ *  response destructor and osrmc_error_destruct(). */
+OSRMC_API size_t
+osrmc_queue_pop_ready(osrmc_queue_t queue,
+                      uint64_t* tickets_out,
+                      void** responses_out,
+                      osrmc_error_t* errors_out,
+                      size_t max,
+                      osrmc_error_t* error);
+/** Blocking variant of osrmc_queue_pop_ready(): waits until at least one
+ *  request completed or nothing is in flight. Returns 0 only when the queue
+ *  is idle. */
+OSRMC_API size_t
+osrmc_queue_pop_wait(osrmc_queue_t queue,
+                     uint64_t* tickets_out,
+                     void** responses_out,
+                     osrmc_error_t* errors_out,
+                     size_t max,
+                     osrmc_error_t* error);
 
 /* Base */
 
@@ -270,6 +660,34 @@ osrmc_params_add_coordinate_with(osrmc_params_t params,
                                  int bearing,
                                  int range,
                                  osrmc_error_t* error);
+/** Appends count coordinates from caller-owned contiguous arrays in a single
+ *  call. The vector is reserved once up front, so loading large traces avoids
+ *  both per-point FFI crossings and incremental reallocation. */
+OSRMC_API void
+osrmc_params_add_coordinates_bulk(osrmc_params_t params,
+                                  const double* longitudes,
+                                  const double* latitudes,
+                                  size_t count,
+                                  osrmc_error_t* error);
+/** Fixed-point variant of osrmc_params_add_coordinates_bulk(): takes int32
+ *  microdegrees, OSRM's internal FixedLongitude/FixedLatitude representation,
+ *  so pipelines that already store fixed-point coordinates skip the
+ *  int->double->fixed round trip. Validation is an integer range check:
+ *  |longitude| <= 180000000 and |latitude| <= 90000000, rejected as a whole
+ *  batch before any coordinate is added. */
+OSRMC_API void
+osrmc_params_add_coordinates_fixed(osrmc_params_t params,
+                                   const int32_t* longitudes,
+                                   const int32_t* latitudes,
+                                   size_t count,
+                                   osrmc_error_t* error);
+/** Marks a params object immutable. The wrapper then never mutates it (hint
+ *  injection is skipped), so one frozen params object can be shared read-only
+ *  across batch and queue workers without cloning. Freezing is advisory:
+ *  callers must stop using setters themselves. Clones of a frozen object are
+ *  mutable again. */
+OSRMC_API void
+osrmc_params_freeze(osrmc_params_t params, osrmc_error_t* error);
 OSRMC_API void
 osrmc_params_set_hint(osrmc_params_t params, size_t coordinate_index, const char* hint_base64, osrmc_error_t* error);
 /** Returns the hint as a base64 string. The returned string pointer is valid only until the next
@@ -279,8 +697,27 @@ osrmc_params_get_hint(osrmc_params_t params,
                       size_t coordinate_index,
                       const char** out_hint_base64,
                       osrmc_error_t* error);
+/** Buffer-filling variant of osrmc_params_get_hint(); see
+ *  osrmc_config_get_memory_file_buf() for the buffer contract. When no hint is
+ *  set for the coordinate, out_needed is set to 0 and buf receives an empty
+ *  string. */
+OSRMC_API void
+osrmc_params_get_hint_buf(osrmc_params_t params,
+                          size_t coordinate_index,
+                          char* buf,
+                          size_t capacity,
+                          size_t* out_needed,
+                          osrmc_error_t* error);
 OSRMC_API void
 osrmc_params_set_radius(osrmc_params_t params, size_t coordinate_index, double radius, osrmc_error_t* error);
+/** Sets the radius for every coordinate from a caller-owned contiguous array.
+ *  count must equal the current coordinate count; a negative radius leaves
+ *  that coordinate unlimited, matching osrmc_params_set_radius(). */
+OSRMC_API void
+osrmc_params_set_radiuses_bulk(osrmc_params_t params,
+                               const double* radiuses,
+                               size_t count,
+                               osrmc_error_t* error);
 OSRMC_API void
 osrmc_params_get_radius(osrmc_params_t params,
                         size_t coordinate_index,
@@ -322,6 +759,22 @@ OSRMC_API void
 osrmc_params_set_snapping(osrmc_params_t params, snapping_t snapping, osrmc_error_t* error);
 OSRMC_API void
 osrmc_params_get_snapping(osrmc_params_t params, snapping_t* out_snapping, osrmc_error_t* error);
+/** Sets a soft deadline for calls made with these params. Batch and
+ *  asynchronous work still queued when the deadline expires is shed with a
+ *  Timeout error instead of being executed; a call that is already running
+ *  inside the engine cannot be interrupted. 0 clears the deadline. */
+OSRMC_API void
+osrmc_params_set_timeout_ms(osrmc_params_t params, int64_t timeout_ms, osrmc_error_t* error);
+OSRMC_API void
+osrmc_params_get_timeout_ms(osrmc_params_t params, int64_t* out_timeout_ms, osrmc_error_t* error);
+/** Tells the wrapper how large the response is expected to be, so the
+ *  FlatBuffer builder starts at that capacity instead of growing through
+ *  realloc-and-copy cycles. Without a hint, a per-thread running estimate of
+ *  recent response sizes for the service is used. 0 clears the hint. */
+OSRMC_API void
+osrmc_params_set_response_size_hint(osrmc_params_t params, size_t bytes, osrmc_error_t* error);
+OSRMC_API void
+osrmc_params_get_response_size_hint(osrmc_params_t params, size_t* out_bytes, osrmc_error_t* error);
 
 /* Nearest */
 
@@ -330,6 +783,17 @@ OSRMC_API osrmc_nearest_params_t
 osrmc_nearest_params_construct(osrmc_error_t* error);
 OSRMC_API void
 osrmc_nearest_params_destruct(osrmc_nearest_params_t params);
+/** Returns an independent deep copy of the params, wrapper metadata (such as
+ *  a timeout) included. One copy replaces re-running every setter when fanning
+ *  out near-identical requests: clone, tweak, dispatch. */
+OSRMC_API osrmc_nearest_params_t
+osrmc_nearest_params_clone(osrmc_nearest_params_t params, osrmc_error_t* error);
+
+/** Clears the logical parameter state back to construction defaults while
+ *  retaining internal vector capacity, so a long-lived params object can be
+ *  recycled across requests without reallocating. */
+OSRMC_API void
+osrmc_nearest_params_reset(osrmc_nearest_params_t params, osrmc_error_t* error);
 // Nearest parameter setters and getters
 OSRMC_API void
 osrmc_nearest_params_set_number_of_results(osrmc_nearest_params_t params, unsigned n, osrmc_error_t* error);
@@ -351,6 +815,68 @@ osrmc_nearest_response_transfer_flatbuffer(osrmc_nearest_response_t response,
                                            size_t* size,
                                            void (**deleter)(void*),
                                            osrmc_error_t* error);
+/** Returns a read-only view of the FlatBuffer response data without copying.
+ *  The pointer is valid only until osrmc_nearest_response_destruct() is called and
+ *  becomes invalid after osrmc_nearest_response_transfer_flatbuffer(). Callers must
+ *  copy the data if they need it beyond the response lifetime. */
+OSRMC_API void
+osrmc_nearest_response_data(osrmc_nearest_response_t response,
+                            const uint8_t** data,
+                            size_t* size,
+                            osrmc_error_t* error);
+/** Writes the FlatBuffer payload straight from the response to a file
+ *  descriptor, bypassing the transfer/copy path entirely. With length_prefix
+ *  non-zero a 4-byte little-endian payload size is sent first, so a stream
+ *  peer can frame messages. Short writes and EINTR are retried until the
+ *  payload is fully written or the descriptor reports a real error; the byte
+ *  count written (including any prefix) is stored in out_written when
+ *  non-null. The response stays valid and can still be read or transferred
+ *  afterwards. Not available on Windows. */
+OSRMC_API void
+osrmc_nearest_response_write_fd(osrmc_nearest_response_t response,
+                                int fd,
+                                int length_prefix,
+                                size_t* out_written,
+                                osrmc_error_t* error);
+
+// Nearest batch execution
+/** Batch variant of osrmc_nearest(); see osrmc_route_batch() for the
+ *  array contract. Fans out across the worker pool when one is configured
+ *  via osrmc_config_set_worker_threads(). */
+OSRMC_API void
+osrmc_nearest_batch(osrmc_osrm_t osrm,
+                    const osrmc_nearest_params_t* params,
+                    size_t count,
+                    osrmc_nearest_response_t* responses_out,
+                    osrmc_error_t* errors_out,
+                    osrmc_error_t* error);
+/** Snaps count coordinates to the road network in one call, writing results
+ *  into caller-provided flat arrays instead of per-point responses. For each
+ *  input point i, out_longitudes[i]/out_latitudes[i] receive the snapped
+ *  position, out_distances[i] the distance to it in meters and out_status[i]
+ *  0 on success or 1 when the point could not be snapped (outputs for that
+ *  point are left untouched). Fans out across the worker pool when one is
+ *  configured. Params construction, FlatBufferBuilders and response objects
+ *  are all reused internally, so this is the cheapest way to snap large
+ *  point sets. */
+OSRMC_API void
+osrmc_nearest_snap_batch(osrmc_osrm_t osrm,
+                         const double* longitudes,
+                         const double* latitudes,
+                         size_t count,
+                         double* out_longitudes,
+                         double* out_latitudes,
+                         double* out_distances,
+                         int* out_status,
+                         osrmc_error_t* error);
+
+// Nearest asynchronous submission
+OSRMC_API osrmc_request_t
+osrmc_nearest_submit(osrmc_osrm_t osrm,
+                     osrmc_nearest_params_t params,
+                     osrmc_completion_t callback,
+                     void* user_data,
+                     osrmc_error_t* error);
 
 /* Route */
 
@@ -359,6 +885,13 @@ OSRMC_API osrmc_route_params_t
 osrmc_route_params_construct(osrmc_error_t* error);
 OSRMC_API void
 osrmc_route_params_destruct(osrmc_route_params_t params);
+// Deep copy; see osrmc_nearest_params_clone()
+OSRMC_API osrmc_route_params_t
+osrmc_route_params_clone(osrmc_route_params_t params, osrmc_error_t* error);
+
+// Clears logical state while retaining vector capacity; see osrmc_nearest_params_reset()
+OSRMC_API void
+osrmc_route_params_reset(osrmc_route_params_t params, osrmc_error_t* error);
 // Route parameter setters and getters
 OSRMC_API void
 osrmc_route_params_set_steps(osrmc_route_params_t params, int on, osrmc_error_t* error);
@@ -417,6 +950,49 @@ osrmc_route_response_transfer_flatbuffer(osrmc_route_response_t response,
                                          size_t* size,
                                          void (**deleter)(void*),
                                          osrmc_error_t* error);
+/** Returns a read-only view of the FlatBuffer response data without copying.
+ *  The pointer is valid only until osrmc_route_response_destruct() is called and
+ *  becomes invalid after osrmc_route_response_transfer_flatbuffer(). Callers must
+ *  copy the data if they need it beyond the response lifetime. */
+OSRMC_API void
+osrmc_route_response_data(osrmc_route_response_t response,
+                          const uint8_t** data,
+                          size_t* size,
+                          osrmc_error_t* error);
+/** Writes the FlatBuffer payload straight to a file descriptor; see
+ *  osrmc_nearest_response_write_fd() for the contract. */
+OSRMC_API void
+osrmc_route_response_write_fd(osrmc_route_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error);
+
+// Route batch execution
+/** Executes count route requests in a single call, amortizing the per-call FFI
+ *  and dispatch overhead. params, responses_out and errors_out must each hold
+ *  count entries. For each request i either responses_out[i] is set and
+ *  errors_out[i] is NULL, or responses_out[i] is NULL and errors_out[i] holds
+ *  the failure. Each response must be destroyed via
+ *  osrmc_route_response_destruct() and each error via osrmc_error_destruct().
+ *  The error output parameter reports failures of the batch call itself
+ *  (e.g. invalid arguments), not of individual requests. Fans out across the
+ *  worker pool when one is configured via osrmc_config_set_worker_threads(). */
+OSRMC_API void
+osrmc_route_batch(osrmc_osrm_t osrm,
+                  const osrmc_route_params_t* params,
+                  size_t count,
+                  osrmc_route_response_t* responses_out,
+                  osrmc_error_t* errors_out,
+                  osrmc_error_t* error);
+
+// Route asynchronous submission
+OSRMC_API osrmc_request_t
+osrmc_route_submit(osrmc_osrm_t osrm,
+                   osrmc_route_params_t params,
+                   osrmc_completion_t callback,
+                   void* user_data,
+                   osrmc_error_t* error);
 
 /* Table */
 
@@ -425,6 +1001,13 @@ OSRMC_API osrmc_table_params_t
 osrmc_table_params_construct(osrmc_error_t* error);
 OSRMC_API void
 osrmc_table_params_destruct(osrmc_table_params_t params);
+// Deep copy; see osrmc_nearest_params_clone()
+OSRMC_API osrmc_table_params_t
+osrmc_table_params_clone(osrmc_table_params_t params, osrmc_error_t* error);
+
+// Clears logical state while retaining vector capacity; see osrmc_nearest_params_reset()
+OSRMC_API void
+osrmc_table_params_reset(osrmc_table_params_t params, osrmc_error_t* error);
 // Table parameter setters and getters
 OSRMC_API void
 osrmc_table_params_add_source(osrmc_table_params_t params, size_t index, osrmc_error_t* error);
@@ -478,6 +1061,90 @@ osrmc_table_response_transfer_flatbuffer(osrmc_table_response_t response,
                                          size_t* size,
                                          void (**deleter)(void*),
                                          osrmc_error_t* error);
+/** Returns a read-only view of the FlatBuffer response data without copying.
+ *  The pointer is valid only until osrmc_table_response_destruct() is called and
+ *  becomes invalid after osrmc_table_response_transfer_flatbuffer(). Callers must
+ *  copy the data if they need it beyond the response lifetime. */
+OSRMC_API void
+osrmc_table_response_data(osrmc_table_response_t response,
+                          const uint8_t** data,
+                          size_t* size,
+                          osrmc_error_t* error);
+/** Writes the FlatBuffer payload straight to a file descriptor; see
+ *  osrmc_nearest_response_write_fd() for the contract. */
+OSRMC_API void
+osrmc_table_response_write_fd(osrmc_table_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error);
+
+// Table response typed getters (read the FlatBuffer natively, no parsing in the binding)
+OSRMC_API void
+osrmc_table_response_get_dimensions(osrmc_table_response_t response,
+                                    size_t* out_rows,
+                                    size_t* out_cols,
+                                    osrmc_error_t* error);
+OSRMC_API void
+osrmc_table_response_get_duration(osrmc_table_response_t response,
+                                  size_t row,
+                                  size_t col,
+                                  float* out_duration,
+                                  osrmc_error_t* error);
+OSRMC_API void
+osrmc_table_response_get_distance(osrmc_table_response_t response,
+                                  size_t row,
+                                  size_t col,
+                                  float* out_distance,
+                                  osrmc_error_t* error);
+/** Copies the whole duration matrix row-major into a caller-provided buffer.
+ *  capacity is the buffer length in floats; fails with BufferTooSmall when it
+ *  is less than rows * cols. If out_count is non-null, it is set to the number
+ *  of floats written. */
+OSRMC_API void
+osrmc_table_response_copy_durations(osrmc_table_response_t response,
+                                    float* out,
+                                    size_t capacity,
+                                    size_t* out_count,
+                                    osrmc_error_t* error);
+// Copies the distance matrix row-major; see osrmc_table_response_copy_durations()
+OSRMC_API void
+osrmc_table_response_copy_distances(osrmc_table_response_t response,
+                                    float* out,
+                                    size_t capacity,
+                                    size_t* out_count,
+                                    osrmc_error_t* error);
+
+// Table batch execution
+/** Batch variant of osrmc_table(); see osrmc_route_batch() for the
+ *  array contract. Fans out across the worker pool when one is configured
+ *  via osrmc_config_set_worker_threads(). */
+OSRMC_API void
+osrmc_table_batch(osrmc_osrm_t osrm,
+                  const osrmc_table_params_t* params,
+                  size_t count,
+                  osrmc_table_response_t* responses_out,
+                  osrmc_error_t* errors_out,
+                  osrmc_error_t* error);
+
+// Table asynchronous submission
+OSRMC_API osrmc_request_t
+osrmc_table_submit(osrmc_osrm_t osrm,
+                   osrmc_table_params_t params,
+                   osrmc_completion_t callback,
+                   void* user_data,
+                   osrmc_error_t* error);
+
+/** Parallel variant of osrmc_table() for large matrices: splits the source
+ *  set into contiguous row blocks, runs the sub-tables concurrently on the
+ *  worker pool and assembles the duration/distance matrices into one
+ *  response. The result is read through the typed table accessors
+ *  (osrmc_table_response_get_duration(), osrmc_table_response_copy_durations()
+ *  and friends); it has no FlatBuffer, so the transfer/view API reports
+ *  InvalidFormat for it. Falls back to a plain osrmc_table() call when no
+ *  worker pool is configured or the matrix is too small to split. */
+OSRMC_API osrmc_table_response_t
+osrmc_table_parallel(osrmc_osrm_t osrm, osrmc_table_params_t params, osrmc_error_t* error);
 
 /* Match */
 
@@ -486,6 +1153,13 @@ OSRMC_API osrmc_match_params_t
 osrmc_match_params_construct(osrmc_error_t* error);
 OSRMC_API void
 osrmc_match_params_destruct(osrmc_match_params_t params);
+// Deep copy; see osrmc_nearest_params_clone()
+OSRMC_API osrmc_match_params_t
+osrmc_match_params_clone(osrmc_match_params_t params, osrmc_error_t* error);
+
+// Clears logical state while retaining vector capacity; see osrmc_nearest_params_reset()
+OSRMC_API void
+osrmc_match_params_reset(osrmc_match_params_t params, osrmc_error_t* error);
 // Match parameter setters and getters
 OSRMC_API void
 osrmc_match_params_set_steps(osrmc_match_params_t params, int on, osrmc_error_t* error);
@@ -530,6 +1204,12 @@ OSRMC_API void
 osrmc_match_params_clear_waypoints(osrmc_match_params_t params, osrmc_error_t* error);
 OSRMC_API void
 osrmc_match_params_add_timestamp(osrmc_match_params_t params, unsigned timestamp, osrmc_error_t* error);
+// Appends count timestamps from a caller-owned contiguous array in a single call
+OSRMC_API void
+osrmc_match_params_add_timestamps_bulk(osrmc_match_params_t params,
+                                       const unsigned* timestamps,
+                                       size_t count,
+                                       osrmc_error_t* error);
 OSRMC_API void
 osrmc_match_params_get_timestamp_count(osrmc_match_params_t params, size_t* out_count, osrmc_error_t* error);
 OSRMC_API void
@@ -561,6 +1241,75 @@ osrmc_match_response_transfer_flatbuffer(osrmc_match_response_t response,
                                          size_t* size,
                                          void (**deleter)(void*),
                                          osrmc_error_t* error);
+/** Returns a read-only view of the FlatBuffer response data without copying.
+ *  The pointer is valid only until osrmc_match_response_destruct() is called and
+ *  becomes invalid after osrmc_match_response_transfer_flatbuffer(). Callers must
+ *  copy the data if they need it beyond the response lifetime. */
+OSRMC_API void
+osrmc_match_response_data(osrmc_match_response_t response,
+                          const uint8_t** data,
+                          size_t* size,
+                          osrmc_error_t* error);
+/** Writes the FlatBuffer payload straight to a file descriptor; see
+ *  osrmc_nearest_response_write_fd() for the contract. */
+OSRMC_API void
+osrmc_match_response_write_fd(osrmc_match_response_t response,
+                              int fd,
+                              int length_prefix,
+                              size_t* out_written,
+                              osrmc_error_t* error);
+
+// Match asynchronous submission
+OSRMC_API osrmc_request_t
+osrmc_match_submit(osrmc_osrm_t osrm,
+                   osrmc_match_params_t params,
+                   osrmc_completion_t callback,
+                   void* user_data,
+                   osrmc_error_t* error);
+
+/* Match session */
+
+/*
+ * Streaming map matching for traces too long for a single osrmc_match() call.
+ * Points are fed incrementally and matched in overlapping windows as they
+ * arrive, so peak memory is bounded by the window size instead of the trace
+ * length. Finished windows are picked up as regular match responses.
+ */
+
+/** Constructs a matching session. params supplies the matching options (gaps,
+ *  tidy, annotations, ...) and is copied; its coordinates and timestamps are
+ *  ignored. Each window matches window_size points, of which the last overlap
+ *  points are carried over into the next window so matchings stay continuous
+ *  across window boundaries. */
+OSRMC_API osrmc_match_session_t
+osrmc_match_session_construct(osrmc_osrm_t osrm,
+                              osrmc_match_params_t params,
+                              size_t window_size,
+                              size_t overlap,
+                              osrmc_error_t* error);
+/** Destructs the session; responses not yet popped are freed. */
+OSRMC_API void
+osrmc_match_session_destruct(osrmc_match_session_t session);
+/** Appends count points from caller-owned arrays. timestamps may be NULL for
+ *  traces without timing. Windows that fill up are matched immediately; their
+ *  responses become available via osrmc_match_session_pop_response(). A
+ *  window that fails to match reports its error here, with the session
+ *  advancing past the failed window. */
+OSRMC_API void
+osrmc_match_session_feed(osrmc_match_session_t session,
+                         const double* longitudes,
+                         const double* latitudes,
+                         const unsigned* timestamps,
+                         size_t count,
+                         osrmc_error_t* error);
+/** Matches whatever points are still buffered as a final, possibly short
+ *  window. A trailing single point cannot be matched and is discarded. */
+OSRMC_API void
+osrmc_match_session_flush(osrmc_match_session_t session, osrmc_error_t* error);
+/** Pops the next finished window response, NULL when none is pending. The
+ *  caller owns the returned response. */
+OSRMC_API osrmc_match_response_t
+osrmc_match_session_pop_response(osrmc_match_session_t session, osrmc_error_t* error);
 
 /* Trip */
 
@@ -569,6 +1318,13 @@ OSRMC_API osrmc_trip_params_t
 osrmc_trip_params_construct(osrmc_error_t* error);
 OSRMC_API void
 osrmc_trip_params_destruct(osrmc_trip_params_t params);
+// Deep copy; see osrmc_nearest_params_clone()
+OSRMC_API osrmc_trip_params_t
+osrmc_trip_params_clone(osrmc_trip_params_t params, osrmc_error_t* error);
+
+// Clears logical state while retaining vector capacity; see osrmc_nearest_params_reset()
+OSRMC_API void
+osrmc_trip_params_reset(osrmc_trip_params_t params, osrmc_error_t* error);
 // Trip parameter setters and getters
 OSRMC_API void
 osrmc_trip_params_set_roundtrip(osrmc_trip_params_t params, int on, osrmc_error_t* error);
@@ -624,6 +1380,16 @@ OSRMC_API void
 osrmc_trip_params_get_waypoint_count(osrmc_trip_params_t params, size_t* out_count, osrmc_error_t* error);
 OSRMC_API void
 osrmc_trip_params_get_waypoint(osrmc_trip_params_t params, size_t index, size_t* out_index, osrmc_error_t* error);
+/** Sets a soft time budget for osrmc_trip_parallel(): once the clustered
+ *  first-pass tour is in hand, the exact solver is only attempted while
+ *  budget remains, so an exhausted budget returns the best tour so far
+ *  instead of waiting. A solver run that is already inside the engine cannot
+ *  be interrupted. 0 clears the budget and always returns the clustered
+ *  result. Ignored by plain osrmc_trip(). */
+OSRMC_API void
+osrmc_trip_params_set_time_budget_ms(osrmc_trip_params_t params, int64_t budget_ms, osrmc_error_t* error);
+OSRMC_API void
+osrmc_trip_params_get_time_budget_ms(osrmc_trip_params_t params, int64_t* out_budget_ms, osrmc_error_t* error);
 
 // Trip response constructor and destructor
 OSRMC_API osrmc_trip_response_t
@@ -640,6 +1406,53 @@ osrmc_trip_response_transfer_flatbuffer(osrmc_trip_response_t response,
                                         size_t* size,
                                         void (**deleter)(void*),
                                         osrmc_error_t* error);
+/** Returns a read-only view of the FlatBuffer response data without copying.
+ *  The pointer is valid only until osrmc_trip_response_destruct() is called and
+ *  becomes invalid after osrmc_trip_response_transfer_flatbuffer(). Callers must
+ *  copy the data if they need it beyond the response lifetime. */
+OSRMC_API void
+osrmc_trip_response_data(osrmc_trip_response_t response,
+                         const uint8_t** data,
+                         size_t* size,
+                         osrmc_error_t* error);
+/** Writes the FlatBuffer payload straight to a file descriptor; see
+ *  osrmc_nearest_response_write_fd() for the contract. */
+OSRMC_API void
+osrmc_trip_response_write_fd(osrmc_trip_response_t response,
+                             int fd,
+                             int length_prefix,
+                             size_t* out_written,
+                             osrmc_error_t* error);
+
+/** Approximate parallel variant of osrmc_trip() for large instances: stops
+ *  are sweep-clustered by polar angle around their centroid, the clusters are
+ *  solved as independent sub-trips across the worker pool
+ *  (osrmc_config_set_worker_threads), and the stitched tour is rendered by a
+ *  single route query. Tours come out a few percent longer than the exact
+ *  solver's in a fraction of the time. When a time budget is set
+ *  (osrmc_trip_params_set_time_budget_ms) and room remains after the
+ *  clustered pass, the exact solver runs too and the shorter tour wins.
+ *  out_order, when non-null, must hold one entry per coordinate and receives
+ *  the visiting order as input indices. Falls back to a plain osrmc_trip()
+ *  call when no pool is configured, cluster_count <= 1, the instance is
+ *  too small to split, or fixed source/destination endpoint constraints are
+ *  set (the clustered stitch cannot honour them). Radiuses, bearings,
+ *  approaches, hints, exclude and snapping set on the params are honoured
+ *  by the sub-trips and the stitched route. */
+OSRMC_API osrmc_trip_response_t
+osrmc_trip_parallel(osrmc_osrm_t osrm,
+                    osrmc_trip_params_t params,
+                    unsigned cluster_count,
+                    size_t* out_order,
+                    osrmc_error_t* error);
+
+// Trip asynchronous submission
+OSRMC_API osrmc_request_t
+osrmc_trip_submit(osrmc_osrm_t osrm,
+                  osrmc_trip_params_t params,
+                  osrmc_completion_t callback,
+                  void* user_data,
+                  osrmc_error_t* error);
 
 /* Tile */
 
@@ -648,6 +1461,13 @@ OSRMC_API osrmc_tile_params_t
 osrmc_tile_params_construct(osrmc_error_t* error);
 OSRMC_API void
 osrmc_tile_params_destruct(osrmc_tile_params_t params);
+// Deep copy; see osrmc_nearest_params_clone()
+OSRMC_API osrmc_tile_params_t
+osrmc_tile_params_clone(osrmc_tile_params_t params, osrmc_error_t* error);
+
+// Clears the tile coordinates back to construction defaults
+OSRMC_API void
+osrmc_tile_params_reset(osrmc_tile_params_t params, osrmc_error_t* error);
 // Tile parameter setters and getters
 OSRMC_API void
 osrmc_tile_params_set_x(osrmc_tile_params_t params, unsigned x, osrmc_error_t* error);
@@ -677,6 +1497,14 @@ osrmc_tile_response_size(osrmc_tile_response_t response, osrmc_error_t* error);
 OSRMC_API const char*
 osrmc_tile_response_data(osrmc_tile_response_t response, size_t* size, osrmc_error_t* error);
 
+// Tile asynchronous submission
+OSRMC_API osrmc_request_t
+osrmc_tile_submit(osrmc_osrm_t osrm,
+                  osrmc_tile_params_t params,
+                  osrmc_completion_t callback,
+                  void* user_data,
+                  osrmc_error_t* error);
+
 #ifdef __cplusplus
 }
 #endif